@@ -0,0 +1,89 @@
+# ===========================================================================
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-17.
+#
+# This file is distributed under the BSD License.
+# License text is included with the source distribution.
+# ===========================================================================
+
+# argos_precompile_help(<target>
+#                       DUMP_TARGET <dump-target>
+#                       [LINE_WIDTHS <width>...]
+#                       [ARGUMENTS <argument>...])
+#
+# Formats the help texts of the program <target> at build time.
+#
+# <dump-target> must be built from the same sources as <target>, but be
+# linked with Argos::Argos, while <target> is linked with
+# Argos::ArgosPrecompiledHelp. A source file that calls
+# argos::enable_help_text_dump() is added to <dump-target>, which is then
+# run with ARGOS_DUMP_HELP set. This makes Argos write the help texts of
+# the program's parser, and the parsers of all its subcommands, to a header
+# instead of parsing the arguments. Programs without that call ignore
+# ARGOS_DUMP_HELP. The header, and a source file that includes it, are
+# added to <target>.
+#
+# LINE_WIDTHS are the line widths the texts are formatted for, the default
+# is 80, 100 and 120. At run time the widest text that fits in the console
+# is used. ARGUMENTS are passed to <dump-target>, and are only needed if
+# the program requires them before it parses its arguments.
+function(argos_precompile_help TARGET)
+    cmake_parse_arguments(ARG "" "DUMP_TARGET" "LINE_WIDTHS;ARGUMENTS" ${ARGN})
+    if(NOT ARG_DUMP_TARGET)
+        message(FATAL_ERROR "argos_precompile_help: DUMP_TARGET is missing.")
+    endif()
+    if(NOT ARG_LINE_WIDTHS)
+        set(ARG_LINE_WIDTHS 80 100 120)
+    endif()
+    string(REPLACE ";" "," LINE_WIDTHS "${ARG_LINE_WIDTHS}")
+
+    set(OUTPUT_DIR ${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_ArgosHelp)
+    set(HEADER ${OUTPUT_DIR}/ArgosHelpTexts.hpp)
+    set(SOURCE ${OUTPUT_DIR}/ArgosHelpTexts.cpp)
+    set(DUMP_SOURCE ${OUTPUT_DIR}/ArgosEnableHelpDump.cpp)
+
+    # Argos gets the program name from argv[0], and the name is part of
+    # the help texts. The dump target is therefore given the same file
+    # name as the target, but in a different directory.
+    get_target_property(OUTPUT_NAME ${TARGET} OUTPUT_NAME)
+    if(NOT OUTPUT_NAME)
+        set(OUTPUT_NAME ${TARGET})
+    endif()
+    set_target_properties(${ARG_DUMP_TARGET}
+        PROPERTIES
+            OUTPUT_NAME ${OUTPUT_NAME}
+            RUNTIME_OUTPUT_DIRECTORY ${OUTPUT_DIR}
+        )
+
+    add_custom_command(OUTPUT ${HEADER}
+        COMMAND ${CMAKE_COMMAND} -E env
+            ARGOS_DUMP_HELP=${HEADER}
+            ARGOS_DUMP_HELP_WIDTHS=${LINE_WIDTHS}
+            $<TARGET_FILE:${ARG_DUMP_TARGET}> ${ARG_ARGUMENTS}
+        DEPENDS ${ARG_DUMP_TARGET}
+        COMMENT "Generating the help texts for ${TARGET}"
+        VERBATIM
+        )
+
+    if(NOT EXISTS ${SOURCE})
+        file(WRITE ${SOURCE} "#include \"ArgosHelpTexts.hpp\"\n")
+    endif()
+
+    if(NOT EXISTS ${DUMP_SOURCE})
+        file(WRITE ${DUMP_SOURCE}
+            "#include <Argos/PrecompiledHelp.hpp>\n"
+            "static const bool argos_help_dump_enabled"
+            " = argos::enable_help_text_dump();\n")
+    endif()
+
+    target_sources(${ARG_DUMP_TARGET}
+        PRIVATE
+            ${DUMP_SOURCE}
+        )
+
+    target_sources(${TARGET}
+        PRIVATE
+            ${HEADER}
+            ${SOURCE}
+        )
+endfunction()
@@ -0,0 +1,69 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <iostream>
+#include <Argos/Argos.hpp>
+
+argos::ArgumentParser make_greet_parser()
+{
+    using namespace argos;
+    return ArgumentParser()
+        .about("Displays a greeting to someone or something.")
+        .add(Argument("NAME").optional(true)
+            .help("The person or thing to greet."))
+        .add(Option{"-n", "--number"}.argument("NUM")
+            .help("The number of times to repeat the greeting."))
+        .move();
+}
+
+argos::ArgumentParser make_count_parser()
+{
+    using namespace argos;
+    return ArgumentParser()
+        .about("Counts from one to the given number.")
+        .add(Argument("NUM").help("The number to count to."))
+        .move();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace argos;
+    const ParsedArguments args = ArgumentParser()
+        .about("Demonstrates help texts that are formatted when the"
+               " program is built rather than when it runs. The program"
+               " can greet and count.")
+        .version("1.0.0")
+        .add(Subcommand("greet", make_greet_parser)
+            .help("Displays a greeting."))
+        .add(Subcommand("count", make_count_parser)
+            .help("Counts to a number."))
+        .parse(argc, argv);
+
+    // The result is STOP after --help and --version.
+    if (args.result_code() != ParserResultCode::SUCCESS)
+        return 0;
+
+    const auto& sub_args = args.subcommand_arguments();
+    if (args.subcommand() == "greet")
+    {
+        int n = sub_args.value("--number").as_int(1);
+        for (int i = 0; i < n; ++i)
+        {
+            std::cout << "Hello "
+                      << sub_args.value("NAME").as_string("world")
+                      << "!\n";
+        }
+    }
+    else
+    {
+        int n = sub_args.value("NUM").as_int();
+        for (int i = 1; i <= n; ++i)
+            std::cout << i << "\n";
+    }
+
+    return 0;
+}
@@ -5,6 +5,7 @@
 // This file is distributed under the BSD License.
 // License text is included with the source distribution.
 //****************************************************************************
+#include <climits>
 #include <filesystem>
 #include <iostream>
 #include <Argos/Argos.hpp>
@@ -10,6 +10,8 @@
 #include "ArgosException.hpp"
 #include "ArgosVersion.hpp"
 #include "ArgumentParser.hpp"
+#include "DelimitedArgumentSource.hpp"
+#include "Schema.hpp"
 
 /**
  * @file
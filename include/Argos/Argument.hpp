@@ -10,6 +10,7 @@
 #include <memory>
 #include <string>
 #include "Callbacks.hpp"
+#include "ValueBinding.hpp"
 
 /**
  * @file
@@ -86,10 +87,13 @@ namespace argos
          *  automatically divided into multiple lines if it doesn't fit
          *  inside the terminal window.
          *  Text formatting with newlines, spaces and tabs is possible.
+         * @param mode Whether the text returned by callback can be reused
+         *  when the help text is written more than once.
          * @return Reference to itself. This makes it possible to chain
          *  method calls.
          */
-        Argument& help(TextCallback callback);
+        Argument& help(TextCallback callback,
+                       TextCallbackMode mode = TextCallbackMode::DYNAMIC);
 
         /**
          * @brief Specifies under which heading the argument will appear
@@ -128,6 +132,60 @@ namespace argos
          */
         Argument& callback(ArgumentCallback callback);
 
+        /**
+         * @brief Convert the argument's values while the command line is
+         *  parsed and assign them to @a target.
+         *
+         * The supported types are bool, the integer and floating point
+         * types that ArgumentValue can convert to, std::string, and
+         * vectors of these. A value that can't be converted is reported
+         * as a parse error.
+         *
+         * Bound values aren't stored in ParsedArguments, only the fact
+         * that the argument was given, which means that
+         * ParsedArguments::has works as usual, while ParsedArguments::value
+         * returns an empty string.
+         *
+         * If the variable is a vector, the first value on the command
+         * line replaces the vector's current contents and the following
+         * values are added to it.
+         *
+         * @note @a target must outlive the parser, and is written to
+         *  every time a command line is parsed.
+         * @note A parser with bound variables must not be used by more
+         *  than one thread at a time, and ArgumentParser::parse_batch
+         *  throws ArgosException for such parsers. Schema is the
+         *  exception, its bindings assign to an object that belongs to
+         *  the calling thread.
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        template <typename T>
+        Argument& bind(T* target)
+        {
+            return bind(make_value_binding(target));
+        }
+
+        /**
+         * @brief Assign the enum value whose name matches the argument's
+         *  value to @a target.
+         *
+         * A value that doesn't match any of the names is reported as a
+         * parse error.
+         */
+        template <typename T,
+                  std::enable_if_t<std::is_enum_v<T>, int> = 0>
+        Argument& bind(T* target, std::vector<std::pair<std::string, T>> values)
+        {
+            return bind(std::make_shared<EnumBinding<T>>(target,
+                                                         std::move(values)));
+        }
+
+        /**
+         * @brief Use @a binding to convert and assign the argument's values.
+         */
+        Argument& bind(std::shared_ptr<IValueBinding> binding);
+
         /**
          * @brief Set restrictions for where this argument is displayed in the
          *      auto-generated help text.
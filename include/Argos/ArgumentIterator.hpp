@@ -7,6 +7,7 @@
 //****************************************************************************
 #pragma once
 
+#include "IArgumentSource.hpp"
 #include "ParsedArguments.hpp"
 
 /**
@@ -32,7 +33,16 @@ namespace argos
          * Client code must use ArgumentParser::make_iterator().
          */
         ArgumentIterator(std::vector<std::string_view> args,
-                         std::shared_ptr<ParserData> parser_data);
+                         std::shared_ptr<const ParserData> parser_data);
+
+        /**
+         * @private
+         * @brief Constructs a new instance of ArgumentIterator.
+         *
+         * Client code must use ArgumentParser::make_iterator().
+         */
+        ArgumentIterator(std::unique_ptr<IArgumentSource> source,
+                         std::shared_ptr<const ParserData> parser_data);
 
         /**
          * @private
@@ -92,6 +102,29 @@ namespace argos
          */
         [[nodiscard]]
         ParsedArguments parsed_arguments() const;
+
+        /**
+         * @brief Returns the next batch of the arguments that were left
+         *      when an iterator that reads from an IArgumentSource stopped.
+         *
+         * Parsing ends before the last argument at errors, and at
+         * options of type STOP, EXIT and LAST_ARGUMENT. An iterator that
+         * reads from a source doesn't copy the remaining arguments to
+         * ParsedArguments::unprocessed_arguments(), instead they are
+         * read from the source one batch at a time by calling this
+         * function until it returns an empty vector. The strings in a
+         * batch remain valid until the function has been called two
+         * more times.
+         *
+         * For other iterators the remaining arguments are in
+         * ParsedArguments::unprocessed_arguments(), and this function
+         * returns an empty vector.
+         *
+         * @throw ArgosException if it's called before next() has
+         *      returned false.
+         */
+        [[nodiscard]]
+        std::vector<std::string_view> remaining_arguments();
     private:
         ArgumentIteratorImpl& impl();
 
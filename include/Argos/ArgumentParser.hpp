@@ -11,6 +11,8 @@
 #include "Argument.hpp"
 #include "ArgumentIterator.hpp"
 #include "Option.hpp"
+#include "ParseContext.hpp"
+#include "Subcommand.hpp"
 
 /**
  * @file
@@ -20,12 +22,23 @@
 namespace argos
 {
     struct ParserData;
+    struct ParserDataCache;
 
     /**
      * @brief This main class of Argos.
      *
      * Use this class to define the program's command line interface and
      * parse the actual command line arguments.
+     *
+     * @par Thread safety
+     * The const member functions, including the const versions of parse()
+     * and make_iterator(), can be called from multiple threads at the same
+     * time as long as no thread calls a non-const member function
+     * concurrently. The first const parse() or make_iterator() creates an
+     * immutable copy of the parser definition, and all later parses
+     * share this copy without copying or locking it, until a non-const
+     * member function is called. Callbacks and text callbacks can be
+     * called from several threads at once when the parser is used this way.
      */
     class ArgumentParser
     {
@@ -75,7 +88,8 @@ namespace argos
         /**
          * @brief Add a new argument definition to the ArgumentParser.
          *
-         * @throw ArgosException if the argument doesn't have a name.
+         * @throw ArgosException if the argument doesn't have a name, or
+         *      if the parser has subcommands.
          */
         ArgumentParser& add(Argument argument);
 
@@ -94,6 +108,28 @@ namespace argos
          */
         ArgumentParser& add(Option option);
 
+        /**
+         * @brief Add a new subcommand definition to the ArgumentParser.
+         *
+         * The first argument on the command line that isn't an option
+         * selects the subcommand, the remaining arguments are parsed by
+         * the ArgumentParser returned by the subcommand's factory. The
+         * subcommand's program name in help and error messages is the
+         * parent's program name followed by the subcommand's name.
+         * ParsedArguments::subcommand() and
+         * ParsedArguments::subcommand_arguments() give access to the
+         * result.
+         *
+         * A command line without a subcommand is an error. The parent's
+         * own options, for instance --help, must appear before the
+         * subcommand.
+         *
+         * @throw ArgosException if the subcommand doesn't have a name or
+         *      a factory, or if the parser has arguments. Parsers with
+         *      subcommands cannot have arguments.
+         */
+        ArgumentParser& add(Subcommand subcommand);
+
         /**
          * @brief Parses the arguments and options in argv.
          *
@@ -145,12 +181,126 @@ namespace argos
          * @note @a args should not have the name of the program itself as its
          *      first value, unlike when parse is called with argc and argv.
          *
+         * @note The parser definition is finalized the first time a const
+         *      parse() or make_iterator() is called, and then shared by later
+         *      calls until the parser is modified. See the note on thread
+         *      safety in the class documentation.
+         *
          * @throw ArgosException if argc is 0 or if there are two or more
          *      options that use the same flag.
          */
         [[nodiscard]]
         ParsedArguments parse(std::vector<std::string_view> args) const;
 
+        /**
+         * @brief Parses the arguments and options in @a args, reusing
+         *      the memory in @a context.
+         *
+         * Otherwise identical to the const version of parse() that
+         * takes a vector of arguments. See ParseContext for when the
+         * memory is reused.
+         *
+         * @throw ArgosException if there are two or more options that
+         *      use the same flag.
+         */
+        [[nodiscard]]
+        ParsedArguments parse(const std::vector<std::string_view>& args,
+                              ParseContext& context) const;
+
+        /**
+         * @brief Splits @a command_line into arguments and parses them.
+         *
+         * The command line is split on white space, and quotes and
+         * backslashes work as in a POSIX shell. Single and double quotes
+         * group characters into one argument. Outside quotes a backslash
+         * escapes the following character, inside double quotes it only
+         * escapes $, `, " and backslash. A backslash followed by a newline
+         * is removed, except inside single quotes. An unterminated quote
+         * extends to the end of the line. There is no expansion of
+         * variables, wildcards or other shell syntax.
+         *
+         * The returned ParsedArguments has its own copy of
+         * @a command_line, the arguments are views into this copy rather
+         * than separately allocated strings. This makes the function
+         * suitable for REPLs and servers that parse many lines with the
+         * same parser.
+         *
+         * @note @a command_line should not start with the name of the
+         *      program.
+         *
+         * @note The ArgumentParser instance is no longer valid after calling
+         *      the non-const version of parse_command_line(). All method
+         *      calls on an invalid ArgumentParser will throw an exception.
+         *
+         * @throw ArgosException if there are two or more options that
+         *      use the same flag.
+         */
+        [[nodiscard]]
+        ParsedArguments parse_command_line(std::string_view command_line);
+
+        /**
+         * @brief Splits @a command_line into arguments and parses them.
+         *
+         * See the non-const version for how @a command_line is split, and
+         * the const version of parse() for how the parser definition is
+         * shared between calls.
+         *
+         * @throw ArgosException if there are two or more options that
+         *      use the same flag.
+         */
+        [[nodiscard]]
+        ParsedArguments parse_command_line(std::string_view command_line) const;
+
+        /**
+         * @brief Splits @a command_line into arguments and parses them,
+         *      reusing the memory in @a context.
+         *
+         * Otherwise identical to the const version of
+         * parse_command_line() without a context. See ParseContext for
+         * when the memory is reused.
+         *
+         * @throw ArgosException if there are two or more options that
+         *      use the same flag.
+         */
+        [[nodiscard]]
+        ParsedArguments parse_command_line(std::string_view command_line,
+                                           ParseContext& context) const;
+
+        /**
+         * @brief Parses several command lines in parallel and returns
+         *      the results in the same order as @a command_lines.
+         *
+         * The command lines are distributed among @a thread_count worker
+         * threads, or as many threads as the hardware supports if
+         * @a thread_count is 0. All workers share a single finalized copy
+         * of the parser definition.
+         *
+         * Parsing never calls exit() and no error messages are written,
+         * regardless of the auto_exit setting. Instead every item with an
+         * invalid command line gets result code ParserResultCode::FAILURE
+         * and its message is available from
+         * ParsedArguments::error_message(). Conversion errors in the
+         * returned ParsedArguments throw ArgosException without writing
+         * anything. The help and version options don't write their texts
+         * either, their items just get result code
+         * ParserResultCode::STOP.
+         *
+         * @note Like with the parse function that takes a vector of
+         *      string_views, the command lines should not have the name of
+         *      the program as their first value.
+         *
+         * @note Callbacks are called from the worker threads, and must be
+         *      safe to call concurrently.
+         *
+         * @throw ArgosException if there are two or more options that
+         *      use the same flag, or if any arguments or options are
+         *      bound to variables. Exceptions thrown by callbacks are
+         *      rethrown once all workers have finished.
+         */
+        [[nodiscard]] std::vector<ParsedArguments>
+        parse_batch(const std::vector<std::vector<std::string_view>>& command_lines,
+                    unsigned thread_count = 0) const;
+
         /**
          * @brief Creates an ArgumentIterator to iterate over the arguments
          *      in argv.
@@ -204,6 +354,52 @@ namespace argos
         [[nodiscard]]
         ArgumentIterator make_iterator(std::vector<std::string_view> args) const;
 
+        /**
+         * @brief Creates an ArgumentIterator that reads the arguments from
+         *      @a source as it needs them.
+         *
+         * This makes it possible to process more arguments than fit in
+         * memory, e.g. a list of file names read from stdin with
+         * DelimitedArgumentSource. The values of arguments are passed on by
+         * ArgumentIterator::next(), but unlike values of options they are
+         * not kept in the iterator's ParsedArguments. The only exception is
+         * when the number of values for an argument depends on the total
+         * number of arguments, as those arguments must be kept until the
+         * last argument has been read.
+         *
+         * Values that are kept are always copied, regardless of the
+         * borrow_arguments setting. Response files are not expanded.
+         *
+         * If the parser has subcommands, every argument after the
+         * subcommand's name is read from @a source and kept in memory
+         * before it's passed on to the subcommand's parser.
+         *
+         * When parsing ends early, because of an error or a STOP option,
+         * the remaining arguments are left in @a source, see
+         * ArgumentIterator::remaining_arguments().
+         *
+         * @note The ArgumentParser instance is no longer valid after calling
+         *      the non-const version of make_iterator(). All method calls on an
+         *      invalid ArgumentParser will throw an exception.
+         *
+         * @throw ArgosException if there are two or more options that use
+         *      the same flag.
+         */
+        [[nodiscard]] ArgumentIterator
+        make_iterator(std::unique_ptr<IArgumentSource> source);
+
+        /**
+         * @brief Creates an ArgumentIterator that reads the arguments from
+         *      @a source as it needs them.
+         *
+         * See the non-const version of this function for details.
+         *
+         * @throw ArgosException if there are two or more options that use
+         *      the same flag.
+         */
+        [[nodiscard]] ArgumentIterator
+        make_iterator(std::unique_ptr<IArgumentSource> source) const;
+
         /**
          * @brief Returns true if the ArgumentParser allows abbreviated options.
          */
@@ -237,6 +433,33 @@ namespace argos
          */
         ArgumentParser& auto_exit(bool value);
 
+        /**
+         * @brief Returns true if parsed values refer directly to the
+         *      command line arguments instead of copies of them.
+         */
+        [[nodiscard]] bool borrow_arguments() const;
+
+        /**
+         * @brief Enable or disable storing parsed values as references to
+         *      the command line arguments.
+         *
+         * By default, ParsedArguments keeps its own copy of every value and
+         * unprocessed argument. When this property is true, the values
+         * instead refer to the strings given to parse() or make_iterator(),
+         * which saves one copy per argument on very long command lines.
+         * Constants, initial values and values assigned with
+         * ParsedArgumentsBuilder are still owned by ParsedArguments.
+         *
+         * @note The caller must make sure that the strings passed to parse()
+         *      or make_iterator() outlive the returned ParsedArguments and
+         *      ArgumentIterator, and any ArgumentValue and ArgumentValues
+         *      obtained from them. This is always the case for the argv
+         *      given to main().
+         *
+         * By default this is off.
+         */
+        ArgumentParser& borrow_arguments(bool value);
+
         /**
          * @brief Returns true if option flags are case insensitive.
          */
@@ -250,6 +473,38 @@ namespace argos
          */
         ArgumentParser& case_insensitive(bool value);
 
+        /**
+         * @brief Returns true if arguments starting with @ are replaced
+         *      by the contents of the file they name.
+         */
+        [[nodiscard]] bool expand_response_files() const;
+
+        /**
+         * @brief Enable or disable response files.
+         *
+         * When enabled, every argument of the form @@path is replaced by the
+         * arguments in the file at path before the command line is parsed.
+         * This makes it possible to pass more arguments than the operating
+         * system permits on a single command line.
+         *
+         * The arguments in the file are separated by white space, and
+         * single quotes, double quotes and backslashes can be used the same
+         * way as in a shell. If the file contains NUL characters, the
+         * arguments are instead separated by NUL and used verbatim, which
+         * is the format produced by e.g. "find -print0". Response files
+         * can refer to other response files, but a file that refers to
+         * itself, directly or indirectly, is an error. An argument that
+         * doesn't name a readable file is kept as it is. Arguments after
+         * "--" are expanded too.
+         *
+         * The files are memory-mapped where possible, and the parsed values
+         * refer directly to the mapped contents, which remain mapped for
+         * as long as the ParsedArguments or ArgumentIterator exist.
+         *
+         * By default this is off.
+         */
+        ArgumentParser& expand_response_files(bool value);
+
         /**
          * @brief Returns whether or not a help option will be auto-generated
          *      if none has been added explicitly.
@@ -414,8 +669,13 @@ namespace argos
          * auto-generated parts of the text, e.g. TextId::USAGE, or
          * add additional text, e.g. TextId::INITIAL_TEXT and
          * TextId::FINAL_TEXT.
+         *
+         * The help text is formatted once for each line width and reused,
+         * unless it contains texts from callbacks with
+         * TextCallbackMode::DYNAMIC.
          */
-        ArgumentParser& text(TextId textId, std::function<std::string()> callback);
+        ArgumentParser& text(TextId textId, std::function<std::string()> callback,
+                             TextCallbackMode mode = TextCallbackMode::DYNAMIC);
 
         /**
          * @brief Sets the line width for help text and error messages.
@@ -425,6 +685,20 @@ namespace argos
          */
         ArgumentParser& line_width(unsigned line_width);
 
+        /**
+         * @brief Returns the handle of the value of the argument or
+         *  option named @a name.
+         *
+         * Retrieving values from ParsedArguments with handles avoids
+         * looking up the name every time. The handle can be used with
+         * all ParsedArguments instances returned by this parser, but
+         * becomes invalid if more arguments or options are added.
+         *
+         * @throw ArgosException if @a name doesn't match the name of any
+         *  argument or option.
+         */
+        [[nodiscard]] ValueHandle value_handle(const std::string& name) const;
+
         /**
          * @brief Write the help text.
          *
@@ -473,8 +747,20 @@ namespace argos
     private:
         void check_data() const;
 
+        void check_data();
+
+        [[nodiscard]]
+        std::shared_ptr<const ParserData> finalized_data() const;
+
         [[nodiscard]] ArgumentId next_argument_id() const;
 
+        friend std::shared_ptr<const ParserData>
+        get_finalized_data(const ArgumentParser& parser);
+
+        friend std::shared_ptr<const ParserData>
+        get_subcommand_data(const ParserData& data, size_t index);
+
         std::unique_ptr<ParserData> m_data;
+        std::unique_ptr<ParserDataCache> m_cache;
     };
 }
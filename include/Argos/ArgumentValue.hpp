@@ -105,9 +105,9 @@ namespace argos
          *
          * If the given value can not be converted to int, an error message
          * is displayed and the program either exits (auto_exit is true) or
-         * the function throws an exception (auto_exit is false). The actual
-         * conversion is performed by @a strtol and @a base is passed unmodified
-         * to that function.
+         * the function throws an exception (auto_exit is false). The conversion
+         * does not depend on the locale and @a base has the same meaning as
+         * for @a strtol.
          *
          * @throw ArgosException if @a auto_exit is false and the given value
          *      can not be converted to int.
@@ -122,9 +122,9 @@ namespace argos
          *
          * If the given value can not be converted to unsigned int, an error
          * message is displayed and the program either exits (auto_exit is true)
-         * or the function throws an exception (auto_exit is false). The actual
-         * conversion is performed by @a strtoul and @a base is passed
-         * unmodified to that function.
+         * or the function throws an exception (auto_exit is false). The conversion
+         * does not depend on the locale and @a base has the same
+         * meaning as for @a strtol.
          *
          * @throw ArgosException if @a auto_exit is false and the given value
          *      can not be converted to unsigned int.
@@ -140,9 +140,9 @@ namespace argos
          *
          * If the given value can not be converted to long, an error
          * message is displayed and the program either exits (auto_exit is true)
-         * or the function throws an exception (auto_exit is false). The actual
-         * conversion is performed by @a strtol and @a base is passed
-         * unmodified to that function.
+         * or the function throws an exception (auto_exit is false). The conversion
+         * does not depend on the locale and @a base has the same
+         * meaning as for @a strtol.
          *
          * @throw ArgosException if @a auto_exit is false and the given value
          *      can not be converted to long.
@@ -157,9 +157,9 @@ namespace argos
          *
          * If the given value can not be converted to long long, an error
          * message is displayed and the program either exits (auto_exit is true)
-         * or the function throws an exception (auto_exit is false). The actual
-         * conversion is performed by @a strtoll and @a base is passed
-         * unmodified to that function.
+         * or the function throws an exception (auto_exit is false). The conversion
+         * does not depend on the locale and @a base has the same
+         * meaning as for @a strtol.
          *
          * @throw ArgosException if @a auto_exit is false and the given value
          *      can not be converted to long long.
@@ -175,9 +175,9 @@ namespace argos
          *
          * If the given value can not be converted to unsigned long, an error
          * message is displayed and the program either exits (auto_exit is true)
-         * or the function throws an exception (auto_exit is false). The actual
-         * conversion is performed by @a strtoul and @a base is passed
-         * unmodified to that function.
+         * or the function throws an exception (auto_exit is false). The conversion
+         * does not depend on the locale and @a base has the same
+         * meaning as for @a strtol.
          *
          * @throw ArgosException if @a auto_exit is false and the given value
          *      can not be converted to unsigned long.
@@ -194,8 +194,8 @@ namespace argos
          * If the given value can not be converted to unsigned long long,
          * an error message is displayed and the program either exits (auto_exit
          * is true) or the function throws an exception (auto_exit is false).
-         * The actual conversion is performed by @a strtoul and @a base is
-         * passed unmodified to that function.
+         * The conversion does not depend on the locale and @a base has
+         * the same meaning as for @a strtol.
          *
          * @throw ArgosException if @a auto_exit is false and the given value
          *      can not be converted to unsigned long.
@@ -260,6 +260,44 @@ namespace argos
         [[nodiscard]] ArgumentValues
         split(char separator, size_t min_parts = 0, size_t max_parts = 0) const;
 
+        /**
+         * @brief Splits the string from the command line on @a separator and
+         *      returns the parts converted to int.
+         *
+         * Returns default_value if the value was not given on the command
+         * line. The result is the same as split(separator).as_ints(), but
+         * the parts are converted directly from the string without any
+         * intermediate lists, which makes a difference for long lists.
+         *
+         * @throw ArgosException if @a auto_exit is false and any of the
+         *      parts can not be converted to int.
+         */
+        [[nodiscard]] std::vector<int>
+        split_as_ints(char separator,
+                      const std::vector<int>& default_value = {},
+                      int base = 10) const;
+
+        /**
+         * @brief Splits the string from the command line on @a separator and
+         *      returns the parts converted to long long.
+         *
+         * Same as split_as_ints, except for the type.
+         */
+        [[nodiscard]] std::vector<long long>
+        split_as_llongs(char separator,
+                        const std::vector<long long>& default_value = {},
+                        int base = 10) const;
+
+        /**
+         * @brief Splits the string from the command line on @a separator and
+         *      returns the parts converted to double.
+         *
+         * Same as split_as_ints, except for the type.
+         */
+        [[nodiscard]] std::vector<double>
+        split_as_doubles(char separator,
+                         const std::vector<double>& default_value = {}) const;
+
         /**
          * Display @a message as if it was an error produced within Argos
          * itself, including a reference to the argument or option this value
@@ -285,6 +285,46 @@ namespace argos
         [[nodiscard]] ArgumentValues
         split(char separator, size_t min_parts = 0, size_t max_parts = 0) const;
 
+        /**
+         * @brief Splits each value on @a separator and returns all the parts
+         *  converted to int in a single list.
+         *
+         * The result is the same as split(separator).as_ints(), but the
+         * parts are converted directly from the values without any
+         * intermediate lists.
+         *
+         * @param separator The separator.
+         * @param default_value This vector is returned if there are no values.
+         * @param base See the documentation for std::strtol for details.
+         * @throw ArgosException if the conversion fails for any part and
+         *  auto_exit is false.
+         */
+        [[nodiscard]] std::vector<int>
+        split_as_ints(char separator,
+                      const std::vector<int>& default_value = {},
+                      int base = 10) const;
+
+        /**
+         * @brief Splits each value on @a separator and returns all the parts
+         *  converted to long long in a single list.
+         *
+         * Same as split_as_ints, except for the type.
+         */
+        [[nodiscard]] std::vector<long long>
+        split_as_llongs(char separator,
+                        const std::vector<long long>& default_value = {},
+                        int base = 10) const;
+
+        /**
+         * @brief Splits each value on @a separator and returns all the parts
+         *  converted to double in a single list.
+         *
+         * Same as split_as_ints, except for the type.
+         */
+        [[nodiscard]] std::vector<double>
+        split_as_doubles(char separator,
+                         const std::vector<double>& default_value = {}) const;
+
         /**
          * @brief Returns an iterator pointing to the first value.
          */
@@ -0,0 +1,57 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <string>
+#include "IArgumentSource.hpp"
+
+/**
+ * @file
+ * @brief Defines the DelimitedArgumentSource class.
+ */
+
+namespace argos
+{
+    /**
+     * @brief Reads arguments separated by a delimiter character from a
+     *      file descriptor, e.g. the output of "find -print0" on stdin.
+     *
+     * The input is read in chunks, and the memory used is bounded by two
+     * chunks, or two times the longest argument if that is greater.
+     */
+    class DelimitedArgumentSource : public IArgumentSource
+    {
+    public:
+        /**
+         * @brief Creates a source that reads from @a fd.
+         *
+         * @param fd The file descriptor, it is not closed by the source.
+         * @param delimiter The character that separates the arguments,
+         *      typically '\\0' or '\\n'. A delimiter after the final
+         *      argument is optional.
+         * @param chunk_size The number of bytes to read at a time.
+         */
+        explicit DelimitedArgumentSource(int fd, char delimiter = '\0',
+                                         size_t chunk_size = 64 * 1024);
+
+        /**
+         * @throw ArgosException if reading from the file descriptor fails.
+         */
+        bool next_batch(std::vector<std::string_view>& args) override;
+    private:
+        size_t read_chunk(std::string& buffer, size_t offset);
+
+        int m_fd;
+        char m_delimiter;
+        size_t m_chunk_size;
+        std::string m_buffers[2];
+        size_t m_buffer_index = 0;
+        std::string_view m_partial_argument;
+        bool m_end_of_file = false;
+    };
+}
@@ -89,7 +89,32 @@ namespace argos
          *      ...
          * ~~~
          */
-        CLEAR
+        CLEAR,
+        /**
+         * @brief The option will add its constant (default is 1) to an
+         *      integer value.
+         *
+         * The count is stored as an integer, and each occurrence of the
+         * option updates it instead of adding another value. Use
+         * Option::limits to keep the count within a range, for instance
+         * to give a verbosity level an upper bound:
+         *
+         * ~~~{.cpp}
+         *  ArgumentParser()
+         *      ...
+         *      .add(Option({"-v", "--verbose"}).alias("VERBOSITY")
+         *          .operation(OptionOperation::COUNT).limits(0, 3))
+         *      .add(Option({"-q", "--quiet"}).alias("VERBOSITY")
+         *          .operation(OptionOperation::COUNT).constant(-1)
+         *          .limits(0, 3))
+         *      ...
+         * ~~~
+         *
+         * If the value has been assigned by an ASSIGN option or an
+         * initial value, and that value is an integer, counting
+         * continues from it. COUNT options can't have an argument.
+         */
+        COUNT
     };
 
     /**
@@ -187,6 +212,28 @@ namespace argos
         FAILURE
     };
 
+    /**
+     * @brief Tells whether the text returned by a TextCallback can be
+     *      reused.
+     *
+     * Argos formats the help text once for each line width and reuses
+     * the result, unless one of the texts in it comes from a dynamic
+     * callback.
+     */
+    enum class TextCallbackMode
+    {
+        /**
+         * @brief The callback is called every time the help text is
+         *      written.
+         */
+        DYNAMIC,
+        /**
+         * @brief The callback always returns the same text, and is only
+         *      called the first time the help text is written.
+         */
+        CACHEABLE
+    };
+
     /**
      * @brief Tells which part of the help text (or error text) is assigned.
      *
@@ -237,7 +284,15 @@ namespace argos
          * @brief Custom usage text for error messages (default is to use
          *      the same text as USAGE).
          */
-        ERROR_USAGE
+        ERROR_USAGE,
+        /**
+         * @brief The title of the list of subcommands (default is
+         *      "COMMANDS").
+         *
+         * @note This will only be used for subcommands without the
+         *      section property.
+         */
+        COMMANDS_TITLE
     };
 
     /**
@@ -0,0 +1,42 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+/**
+ * @file
+ * @brief Defines the IArgumentSource interface class.
+ */
+
+namespace argos
+{
+    /**
+     * @brief Interface for classes that supply command line arguments
+     *      in batches while an ArgumentIterator consumes them.
+     *
+     * @see ArgumentParser::make_iterator(std::unique_ptr<IArgumentSource>)
+     */
+    class IArgumentSource
+    {
+    public:
+        virtual ~IArgumentSource() = default;
+
+        /**
+         * @brief Replaces the contents of @a args with the next batch of
+         *      arguments.
+         *
+         * Returns false if there are no more arguments. The strings in
+         * a batch must remain valid until next_batch has been called two
+         * more times, i.e. Argos never refers to strings in more than the
+         * current and the previous batch.
+         */
+        virtual bool next_batch(std::vector<std::string_view>& args) = 0;
+    };
+}
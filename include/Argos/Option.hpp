@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 #include "Callbacks.hpp"
+#include "ValueBinding.hpp"
 
 /**
  * @file
@@ -86,10 +87,13 @@ namespace argos
          *  automatically divided into multiple lines if it doesn't fit
          *  inside the terminal window.
          *  Text formatting with newlines, spaces and tabs is possible.
+         * @param mode Whether the text returned by callback can be reused
+         *  when the help text is written more than once.
          * @return Reference to itself. This makes it possible to chain
          *  method calls.
          */
-        Option& help(TextCallback callback);
+        Option& help(TextCallback callback,
+                     TextCallbackMode mode = TextCallbackMode::DYNAMIC);
 
         /**
          * @brief Specifies under which heading the option will appear
@@ -154,6 +158,61 @@ namespace argos
          */
         Option& callback(OptionCallback callback);
 
+        /**
+         * @brief Convert the option's values while the command line is
+         *  parsed and assign them to @a target.
+         *
+         * The supported types are bool, the integer and floating point
+         * types that ArgumentValue can convert to, std::string, and
+         * vectors of these. A value that can't be converted is reported
+         * as a parse error.
+         *
+         * Bound values aren't stored in ParsedArguments, only the fact
+         * that the option was given, which means that
+         * ParsedArguments::has works as usual, while ParsedArguments::value
+         * returns an empty string.
+         *
+         * If the variable is a vector and the option's operation is
+         * APPEND, the first value on the command line replaces the
+         * vector's current contents and the following values are added
+         * to it.
+         *
+         * @note @a target must outlive the parser, and is written to
+         *  every time a command line is parsed.
+         * @note A parser with bound variables must not be used by more
+         *  than one thread at a time, and ArgumentParser::parse_batch
+         *  throws ArgosException for such parsers. Schema is the
+         *  exception, its bindings assign to an object that belongs to
+         *  the calling thread.
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        template <typename T>
+        Option& bind(T* target)
+        {
+            return bind(make_value_binding(target));
+        }
+
+        /**
+         * @brief Assign the enum value whose name matches the option's
+         *  value to @a target.
+         *
+         * A value that doesn't match any of the names is reported as a
+         * parse error.
+         */
+        template <typename T,
+                  std::enable_if_t<std::is_enum_v<T>, int> = 0>
+        Option& bind(T* target, std::vector<std::pair<std::string, T>> values)
+        {
+            return bind(std::make_shared<EnumBinding<T>>(target,
+                                                         std::move(values)));
+        }
+
+        /**
+         * @brief Use @a binding to convert and assign the option's values.
+         */
+        Option& bind(std::shared_ptr<IValueBinding> binding);
+
         /**
          * @brief Set restrictions for where this option is displayed in the
          *  auto-generated help text.
@@ -239,6 +298,61 @@ namespace argos
          */
         Option& initial_value(const std::string& value);
 
+        /**
+         * @brief Sets a value that will be assigned to the option before
+         *  arguments are parsed.
+         *
+         * See initial_value(const std::string&).
+         *
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        Option& initial_value(const char* value);
+
+        /**
+         * @brief Sets a value that will be assigned to the option before
+         *  arguments are parsed.
+         *
+         * See initial_value(const std::string&) and constant(bool).
+         *
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        Option& initial_value(bool value);
+
+        /**
+         * @brief Sets a value that will be assigned to the option before
+         *  arguments are parsed.
+         *
+         * See initial_value(const std::string&) and constant(long long).
+         *
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        Option& initial_value(int value);
+
+        /**
+         * @brief Sets a value that will be assigned to the option before
+         *  arguments are parsed.
+         *
+         * See initial_value(const std::string&) and constant(long long).
+         *
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        Option& initial_value(long long value);
+
+        /**
+         * @brief Sets a value that will be assigned to the option before
+         *  arguments are parsed.
+         *
+         * See initial_value(const std::string&) and constant(double).
+         *
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        Option& initial_value(double value);
+
         /**
          * @brief Sets the value that this option will assign to the
          *  corresponding value in ParsedArguments.
@@ -263,9 +377,10 @@ namespace argos
          *
          * Options that have no argument and no explicit constant will
          * automatically have the constant *true*.
-
-         * @note All values are stored as strings internally, true and false are
-         *  converted to "1" and "0" respectively..
+         *
+         * @note The value is stored both as a bool and as a string, true
+         *  and false are converted to "1" and "0" respectively. ArgumentValue's
+         *  as_int(), as_double() etc. use the bool and don't parse the string.
          * @return Reference to itself. This makes it possible to chain
          *  method calls.
          */
@@ -275,8 +390,9 @@ namespace argos
          * @brief Sets the value that this option will assign to the
          *  corresponding value in ParsedArguments.
          *
-         * @note All values are stored as strings internally, i.e. constant(123) and
-         *  constant("123") are equivalent.
+         * @note constant(123) and constant("123") give the same string
+         *  value, but ArgumentValue's as_int() etc. only have to parse
+         *  the latter.
          * @return Reference to itself. This makes it possible to chain
          *  method calls.
          */
@@ -285,13 +401,37 @@ namespace argos
         /**
          * @brief Sets the value that this option will assign to the underlying value.
          *
-         * @note All values are stored as strings internally, i.e. constant(123LL) and
-         *  constant("123") are equivalent.
+         * @note constant(123LL) and constant("123") give the same string
+         *  value, but ArgumentValue's as_int() etc. only have to parse
+         *  the latter.
          * @return Reference to itself. This makes it possible to chain
          *  method calls.
          */
         Option& constant(long long value);
 
+        /**
+         * @brief Sets the value that this option will assign to the underlying value.
+         *
+         * @note The string value is the shortest representation that
+         *  converts back to the same double. ArgumentValue's as_double()
+         *  doesn't parse it.
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        Option& constant(double value);
+
+        /**
+         * @brief Sets the lowest and highest value a COUNT option can
+         *  count to.
+         *
+         * Counts that would go past either limit stay at the limit.
+         *
+         * @throw ArgosException if @a min is greater than @a max.
+         * @return Reference to itself. This makes it possible to chain
+         *  method calls.
+         */
+        Option& limits(long long min, long long max);
+
         /**
          * @brief Sets the option type.
          *
@@ -0,0 +1,66 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <memory>
+
+/**
+ * @file
+ * @brief Defines the ParseContext class.
+ */
+
+namespace argos
+{
+    class ArgumentIteratorImpl;
+
+    /**
+     * @brief Keeps the memory used by one parse so that the next parse
+     *      can reuse it.
+     *
+     * Programs that parse many command lines, for instance a server that
+     * receives commands from its clients, can keep a ParseContext per
+     * thread and pass it to ArgumentParser::parse() or
+     * ArgumentParser::parse_command_line(). A parse with a context
+     * clears the state of the previous parse, but keeps the allocated
+     * memory. When the parser and the sizes of the command lines are
+     * stable, a parse normally doesn't allocate any memory.
+     *
+     * The ParsedArguments returned by the previous parse are only reused
+     * if the client code no longer refers to them, either directly or
+     * through ArgumentValue, ArgumentValues or argument views. Otherwise
+     * the next parse allocates a new result, and the old one remains
+     * valid.
+     *
+     * A ParseContext must not be used by two threads at the same time.
+     */
+    class ParseContext
+    {
+    public:
+        ParseContext();
+
+        /**
+         * @private
+         */
+        ParseContext(const ParseContext&) = delete;
+
+        ParseContext(ParseContext&&) noexcept;
+
+        ~ParseContext();
+
+        /**
+         * @private
+         */
+        ParseContext& operator=(const ParseContext&) = delete;
+
+        ParseContext& operator=(ParseContext&&) noexcept;
+    private:
+        friend class ArgumentParser;
+
+        std::unique_ptr<ArgumentIteratorImpl> m_impl;
+    };
+}
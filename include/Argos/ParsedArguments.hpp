@@ -12,6 +12,7 @@
 #include "ArgumentValues.hpp"
 #include "ArgumentView.hpp"
 #include "OptionView.hpp"
+#include "ValueHandle.hpp"
 
 /**
  * @file
@@ -79,6 +80,14 @@ namespace argos
          */
         [[nodiscard]] bool has(const IArgumentView& arg) const;
 
+        /**
+         * @brief Returns true if the argument or option identified by
+         *  @a handle was given on command line.
+         *
+         * @throw ArgosException if @a handle is invalid.
+         */
+        [[nodiscard]] bool has(ValueHandle handle) const;
+
         /**
          * @brief Returns the value of the argument with the given name.
          *
@@ -92,6 +101,14 @@ namespace argos
          */
         [[nodiscard]] ArgumentValue value(const IArgumentView& arg) const;
 
+        /**
+         * @brief Returns the value of the argument or option identified
+         *  by @a handle.
+         *
+         * @throw ArgosException if @a handle is invalid.
+         */
+        [[nodiscard]] ArgumentValue value(ValueHandle handle) const;
+
         /**
          * @brief Returns the values of the argument with the given name.
          *
@@ -105,6 +122,26 @@ namespace argos
          */
         [[nodiscard]] ArgumentValues values(const IArgumentView& arg) const;
 
+        /**
+         * @brief Returns the values of the argument or option identified
+         *  by @a handle.
+         *
+         * @throw ArgosException if @a handle is invalid.
+         */
+        [[nodiscard]] ArgumentValues values(ValueHandle handle) const;
+
+        /**
+         * @brief Returns the handle of the value of the argument or
+         *  option named @a name.
+         *
+         * The handle can also be used with other ParsedArguments
+         * instances returned by the same parser.
+         *
+         * @throw ArgosException if @a name doesn't match the name of any
+         *  argument or option.
+         */
+        [[nodiscard]] ValueHandle value_handle(const std::string& name) const;
+
         /**
          * @brief Returns all argument definitions that were registered with
          *  ArgumentParser.
@@ -130,12 +167,42 @@ namespace argos
          */
         [[nodiscard]] ParserResultCode result_code() const;
 
+        /**
+         * @brief Returns the message that describes why parsing failed.
+         *
+         * The message is empty unless result_code() is
+         * ParserResultCode::FAILURE. It does not include the program name
+         * or the usage text that are written along with it.
+         */
+        [[nodiscard]] const std::string& error_message() const;
+
         /**
          * @brief If the parser stopped early because it encountered an option
          *  of type, this function returns that option.
          */
         [[nodiscard]] OptionView stop_option() const;
 
+        /**
+         * @brief Returns the name of the subcommand that was selected on
+         *  the command line, or an empty string if the parser doesn't
+         *  have subcommands or parsing stopped before the subcommand.
+         *
+         * The name is returned as it was defined, even if the parser is
+         * case-insensitive.
+         */
+        [[nodiscard]] const std::string& subcommand() const;
+
+        /**
+         * @brief Returns the result of parsing the subcommand's arguments
+         *  with the subcommand's ArgumentParser.
+         *
+         * The returned object belongs to this object and must not be
+         * used after this object has been destroyed.
+         *
+         * @throw ArgosException if no subcommand was selected.
+         */
+        [[nodiscard]] const ParsedArguments& subcommand_arguments() const;
+
         /**
          * @brief Returns the command line arguments that were ignored by the
          *  argument parser.
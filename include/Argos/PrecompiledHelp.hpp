@@ -0,0 +1,89 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @file
+ * @brief Defines the types used by help texts that are formatted at
+ *      build time.
+ */
+
+namespace argos
+{
+    /**
+     * @brief The help text of one parser formatted for one line width.
+     *
+     * Tables of PrecompiledHelpText are generated at build time by the
+     * CMake function argos_precompile_help(), which runs a dump build of
+     * the program with the environment variable ARGOS_DUMP_HELP set.
+     * Programs that are linked with the ArgosPrecompiledHelp library write
+     * these texts instead of formatting the help text at run time, and
+     * don't contain the text formatter.
+     */
+    struct PrecompiledHelpText
+    {
+        /**
+         * @brief The program name of the parser, subcommands' parsers
+         *      have names like "program command".
+         */
+        std::string_view program_name;
+        /**
+         * @brief The line width the texts have been formatted for.
+         */
+        unsigned line_width;
+        /**
+         * @brief The complete help text.
+         */
+        std::string_view help_text;
+        /**
+         * @brief The text that follows the message in error messages.
+         */
+        std::string_view error_usage;
+    };
+
+    /**
+     * @brief Registers the help texts that are used by the
+     *      ArgosPrecompiledHelp library.
+     *
+     * The generated headers call this function, programs normally don't.
+     * The regular Argos library ignores the texts.
+     *
+     * @param texts The table must remain valid as long as
+     *      any parser is used.
+     * @param count The number of entries in texts.
+     * @return Always true.
+     */
+    bool set_precompiled_help_texts(const PrecompiledHelpText* texts,
+                                    size_t count);
+
+    /**
+     * @brief Registers the help texts that are used by the
+     *      ArgosPrecompiledHelp library.
+     */
+    template <size_t N>
+    bool set_precompiled_help_texts(const PrecompiledHelpText (&texts)[N])
+    {
+        return set_precompiled_help_texts(texts, N);
+    }
+
+    /**
+     * @brief Lets the environment variable ARGOS_DUMP_HELP make the
+     *      program write its help texts to a header instead of parsing
+     *      its arguments.
+     *
+     * argos_precompile_help() adds a source file that calls this
+     * function to the dump target. Programs that don't call it never
+     * read ARGOS_DUMP_HELP.
+     *
+     * @return Always true.
+     */
+    bool enable_help_text_dump();
+}
@@ -0,0 +1,380 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include "ArgosException.hpp"
+#include "ArgumentParser.hpp"
+
+/**
+ * @file
+ * @brief Defines the Schema class.
+ */
+
+namespace argos
+{
+    /**
+     * @private
+     * @brief The object a Schema is currently filling in on this thread.
+     */
+    template <typename T>
+    struct SchemaTarget
+    {
+        inline static thread_local T* object = nullptr;
+    };
+
+    /**
+     * @private
+     * @brief Converts values with parse_value.
+     */
+    struct DefaultValueParser
+    {
+        template <typename V>
+        bool operator()(std::string_view str, V& value) const
+        {
+            return parse_value(str, value);
+        }
+    };
+
+    /**
+     * @private
+     * @brief Converts values with a table of enum names.
+     */
+    template <typename E>
+    struct EnumValueParser
+    {
+        bool operator()(std::string_view str, E& value) const
+        {
+            for (const auto& [name, v] : values)
+            {
+                if (name == str)
+                {
+                    value = v;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::vector<std::pair<std::string, E>> values;
+    };
+
+    /**
+     * @private
+     * @brief Binds a value to member @a M of the object a Schema is
+     *      currently filling in.
+     */
+    template <typename T, typename M, typename Parser>
+    class MemberBinding : public IValueBinding
+    {
+    public:
+        MemberBinding(M T::* member, Parser parser)
+            : m_member(member),
+              m_parser(std::move(parser))
+        {}
+
+        bool assign(std::string_view value) override
+        {
+            if constexpr (IS_VECTOR)
+            {
+                typename M::value_type v{};
+                if (!m_parser(value, v))
+                    return false;
+                auto& target = this->target();
+                target.clear();
+                target.push_back(std::move(v));
+                return true;
+            }
+            else
+            {
+                return m_parser(value, target());
+            }
+        }
+
+        bool append(std::string_view value) override
+        {
+            if constexpr (IS_VECTOR)
+            {
+                typename M::value_type v{};
+                if (!m_parser(value, v))
+                    return false;
+                target().push_back(std::move(v));
+                return true;
+            }
+            else
+            {
+                return m_parser(value, target());
+            }
+        }
+
+        void clear() override
+        {
+            if constexpr (IS_VECTOR)
+                target().clear();
+            else
+                target() = M();
+        }
+    private:
+        template <typename V>
+        struct IsVector : std::false_type
+        {};
+
+        template <typename V, typename A>
+        struct IsVector<std::vector<V, A>> : std::true_type
+        {};
+
+        static constexpr bool IS_VECTOR = IsVector<M>::value;
+
+        M& target() const
+        {
+            auto* object = SchemaTarget<T>::object;
+            if (!object)
+            {
+                throw ArgosException(
+                    "Schema fields can only be assigned by Schema::parse.");
+            }
+            return object->*m_member;
+        }
+
+        M T::* m_member;
+        Parser m_parser;
+    };
+
+    /**
+     * @brief Maps arguments and options to the members of a struct and
+     *      parses command lines directly into instances of it.
+     *
+     * Each call to field() adds an Argument or Option to the schema's
+     * ArgumentParser and binds its value to a member of @a T. The values
+     * are converted while the command line is parsed, and they are
+     * converted with the same rules as ArgumentValue's as_int,
+     * as_double etc. Members can be bool, int, unsigned, long,
+     * unsigned long, long long, unsigned long long, float, double,
+     * std::string, std::vector of any of these or, with a table of
+     * names, enums.
+     *
+     * Example:
+     * ~~~{.cpp}
+     * struct Config
+     * {
+     *     int jobs = 1;
+     *     std::vector<std::string> files;
+     * };
+     *
+     * Schema<Config> schema;
+     * schema.field(&Config::jobs, Option{"-j", "--jobs"}.argument("N"))
+     *       .field(&Config::files, Argument("FILE").count(0, 100));
+     * Config config = schema.parse(argc, argv);
+     * ~~~
+     *
+     * Members that aren't given on the command line keep the values
+     * they have in the object passed to parse(), or the values of a
+     * default constructed @a T.
+     *
+     * Since the values are assigned directly to the members, the
+     * ParsedArguments returned by parse() only tell whether each value
+     * was given, not what it was.
+     *
+     * @note Several threads can call the const member functions of a
+     *      Schema at the same time.
+     */
+    template <typename T>
+    class Schema
+    {
+    public:
+        /**
+         * @brief Creates a schema with an empty ArgumentParser.
+         */
+        Schema() = default;
+
+        /**
+         * @brief Creates a schema that adds its fields to @a parser.
+         */
+        explicit Schema(ArgumentParser parser)
+            : m_parser(std::move(parser))
+        {}
+
+        /**
+         * @brief Returns the schema's ArgumentParser.
+         *
+         * Use it to set the parser's properties, and to add options and
+         * arguments that aren't stored in @a T, for instance help and
+         * version options.
+         */
+        [[nodiscard]] ArgumentParser& parser()
+        {
+            return m_parser;
+        }
+
+        /**
+         * @brief Returns the schema's ArgumentParser.
+         */
+        [[nodiscard]] const ArgumentParser& parser() const
+        {
+            return m_parser;
+        }
+
+        /**
+         * @brief Adds @a argument to the parser and assigns its value or
+         *      values to @a member.
+         */
+        template <typename M>
+        Schema& field(M T::* member, Argument argument)
+        {
+            m_parser.add(std::move(argument.bind(make_binding(
+                member, DefaultValueParser()))));
+            return *this;
+        }
+
+        /**
+         * @brief Adds @a option to the parser and assigns its value or
+         *      values to @a member.
+         *
+         * Options without argument or value assign @a true (or 1) to
+         * @a member, while CLEAR options reset it.
+         */
+        template <typename M>
+        Schema& field(M T::* member, Option option)
+        {
+            m_parser.add(std::move(option.bind(make_binding(
+                member, DefaultValueParser()))));
+            return *this;
+        }
+
+        /**
+         * @brief Adds @a argument to the parser and assigns the enum
+         *      value whose name matches the argument to @a member.
+         */
+        template <typename E>
+        Schema& field(E T::* member, Argument argument,
+                      std::vector<std::pair<std::string, E>> values)
+        {
+            m_parser.add(std::move(argument.bind(make_binding(
+                member, EnumValueParser<E>{std::move(values)}))));
+            return *this;
+        }
+
+        /**
+         * @brief Adds @a option to the parser and assigns the enum value
+         *      whose name matches the option's argument to @a member.
+         */
+        template <typename E>
+        Schema& field(E T::* member, Option option,
+                      std::vector<std::pair<std::string, E>> values)
+        {
+            m_parser.add(std::move(option.bind(make_binding(
+                member, EnumValueParser<E>{std::move(values)}))));
+            return *this;
+        }
+
+        /**
+         * @brief Parses the arguments in argv and assigns their values
+         *      to the members of @a result.
+         *
+         * @note Unlike the parse() functions that take a vector of
+         *      string_views, this function skips argv[0].
+         */
+        ParsedArguments parse(int argc, char* argv[], T& result) const
+        {
+            ObjectGuard guard(result);
+            return m_parser.parse(argc, argv);
+        }
+
+        /**
+         * @brief Parses @a args and assigns their values to the members
+         *      of @a result.
+         */
+        ParsedArguments parse(std::vector<std::string_view> args,
+                              T& result) const
+        {
+            ObjectGuard guard(result);
+            return m_parser.parse(std::move(args));
+        }
+
+        /**
+         * @brief Parses the arguments in argv and returns a default
+         *      constructed @a T with their values.
+         */
+        [[nodiscard]] T parse(int argc, char* argv[]) const
+        {
+            T result{};
+            (void)parse(argc, argv, result);
+            return result;
+        }
+
+        /**
+         * @brief Parses @a args and returns a default constructed @a T
+         *      with their values.
+         */
+        [[nodiscard]] T parse(std::vector<std::string_view> args) const
+        {
+            T result{};
+            (void)parse(std::move(args), result);
+            return result;
+        }
+
+        /**
+         * @brief Parses each of @a command_lines and returns the
+         *      results in the same order.
+         *
+         * Unlike ArgumentParser::parse_batch, the command lines are
+         * parsed one at a time on the calling thread, and command lines
+         * with errors are handled according to the parser's auto_exit
+         * setting. Set it to false and pass @a result_codes to find out
+         * which command lines failed; their objects only contain the
+         * values that were assigned before the error was encountered.
+         */
+        [[nodiscard]] std::vector<T>
+        parse_all(const std::vector<std::vector<std::string_view>>& command_lines,
+                  std::vector<ParserResultCode>* result_codes = nullptr) const
+        {
+            std::vector<T> result(command_lines.size());
+            if (result_codes)
+                result_codes->resize(command_lines.size());
+            for (size_t i = 0; i < command_lines.size(); ++i)
+            {
+                auto args = parse(command_lines[i], result[i]);
+                if (result_codes)
+                    (*result_codes)[i] = args.result_code();
+            }
+            return result;
+        }
+    private:
+        // Makes obj the target of the member bindings for the duration
+        // of a parse, and restores the previous target afterwards in case
+        // a callback uses the same schema recursively.
+        class ObjectGuard
+        {
+        public:
+            explicit ObjectGuard(T& obj)
+                : m_previous(SchemaTarget<T>::object)
+            {
+                SchemaTarget<T>::object = &obj;
+            }
+
+            ObjectGuard(const ObjectGuard&) = delete;
+
+            ~ObjectGuard()
+            {
+                SchemaTarget<T>::object = m_previous;
+            }
+
+            ObjectGuard& operator=(const ObjectGuard&) = delete;
+        private:
+            T* m_previous;
+        };
+
+        template <typename M, typename Parser>
+        static std::shared_ptr<IValueBinding>
+        make_binding(M T::* member, Parser parser)
+        {
+            return std::make_shared<MemberBinding<T, M, Parser>>(
+                member, std::move(parser));
+        }
+
+        ArgumentParser m_parser;
+    };
+}
@@ -0,0 +1,160 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include "Callbacks.hpp"
+
+/**
+ * @file
+ * @brief Defines the Subcommand class.
+ */
+
+namespace argos
+{
+    class ArgumentParser;
+    struct SubcommandData;
+
+    /**
+     * @brief A function that creates the ArgumentParser for a subcommand.
+     */
+    using SubcommandFactory = std::function<ArgumentParser()>;
+
+    /**
+     * @brief Class for defining subcommands, as in "git commit" and
+     *      "git push".
+     *
+     * A subcommand consists of a name and a factory function that creates
+     * the ArgumentParser for the subcommand's own arguments and options.
+     * Once the subcommand has been defined it must be *added* to the
+     * ArgumentParser with ArgumentParser::add.
+     *
+     * The factory is only called for the subcommand that is actually
+     * selected on the command line, the parsers for the other subcommands
+     * are never created. The parent parser's help text lists the
+     * subcommands using only their names and help texts.
+     *
+     * The factory is called once, the first time the subcommand is
+     * selected, and its parser is reused in later calls to the parent's
+     * parse functions. The subcommand's parser inherits the parent's
+     * auto_exit setting and output stream.
+     */
+    class Subcommand
+    {
+    public:
+        /**
+         * @brief Creates a subcommand without a name or a factory.
+         */
+        Subcommand();
+
+        /**
+         * @brief Creates a subcommand with name @a name whose arguments
+         *      and options are parsed by the ArgumentParser returned by
+         *      @a factory.
+         */
+        Subcommand(const std::string& name, SubcommandFactory factory);
+
+        /**
+         * @brief Creates a complete copy of the given subcommand.
+         */
+        Subcommand(const Subcommand&);
+
+        /**
+         * @brief Moves the innards of the given subcommand to the new
+         *      object.
+         *
+         * Attempts to use the old object will result in an exception.
+         */
+        Subcommand(Subcommand&&) noexcept;
+
+        ~Subcommand();
+
+        /**
+         * @brief Copies everything in the given subcommand.
+         */
+        Subcommand& operator=(const Subcommand&);
+
+        /**
+         * @brief Moves the innards of the given subcommand to the current
+         * object.
+         *
+         * Attempts to use the old object will result in an exception.
+         */
+        Subcommand& operator=(Subcommand&&) noexcept;
+
+        /**
+         * @brief Set the subcommand's help text in the parent's help text.
+         * @return Reference to itself. This makes it possible to chain
+         *      method calls.
+         */
+        Subcommand& help(const std::string& text);
+
+        /**
+         * @brief Set a callback that produces the subcommand's help text
+         *      in the parent's help text.
+         * @param mode Whether the text returned by callback can be reused
+         *      when the help text is written more than once.
+         * @return Reference to itself. This makes it possible to chain
+         *      method calls.
+         */
+        Subcommand& help(TextCallback callback,
+                         TextCallbackMode mode = TextCallbackMode::DYNAMIC);
+
+        /**
+         * @brief Specifies under which heading the subcommand will appear
+         *      in the parent's help text.
+         *
+         * The default heading for subcommands is "COMMANDS".
+         * @return Reference to itself. This makes it possible to chain
+         *      method calls.
+         */
+        Subcommand& section(const std::string& name);
+
+        /**
+         * @brief Set restrictions for where this subcommand is displayed
+         *      in the parent's help text.
+         *
+         * Subcommands never appear individually in the usage, only
+         * Visibility::TEXT has any effect.
+         * @return Reference to itself. This makes it possible to chain
+         *      method calls.
+         */
+        Subcommand& visibility(Visibility visibility);
+
+        /**
+         * @brief Set the name of the subcommand.
+         * @return Reference to itself. This makes it possible to chain
+         *      method calls.
+         */
+        Subcommand& name(const std::string& name);
+
+        /**
+         * @brief Set the function that creates the subcommand's
+         *      ArgumentParser.
+         * @return Reference to itself. This makes it possible to chain
+         *      method calls.
+         */
+        Subcommand& factory(SubcommandFactory factory);
+
+        /**
+         * @private
+         * @brief Used internally in Argos.
+         *
+         * The object is no longer usable after this function has
+         * been called.
+         * @return Pointer to the subcommand implementation.
+         */
+        std::unique_ptr<SubcommandData> release();
+    private:
+        void check_subcommand() const;
+
+        std::unique_ptr<SubcommandData> m_subcommand;
+    };
+}
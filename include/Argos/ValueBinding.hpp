@@ -0,0 +1,192 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file
+ * @brief Defines the IValueBinding interface class and the functions
+ *      that create bindings to variables.
+ */
+
+namespace argos
+{
+    /**
+     * @brief Interface for the objects that convert the values of
+     *      arguments and options and assign them to variables while the
+     *      command line is parsed.
+     *
+     * Argument::bind and Option::bind create these objects for the
+     * supported variable types. Implement this interface to bind
+     * values to variables of other types.
+     */
+    class IValueBinding
+    {
+    public:
+        virtual ~IValueBinding() = default;
+
+        /**
+         * @brief Converts @a value and replaces the variable's current
+         *      value with it.
+         *
+         * @return false if @a value can't be converted.
+         */
+        virtual bool assign(std::string_view value) = 0;
+
+        /**
+         * @brief Converts @a value and adds it to the variable if it's
+         *      a vector, or replaces the current value if it isn't.
+         *
+         * @return false if @a value can't be converted.
+         */
+        virtual bool append(std::string_view value) = 0;
+
+        /**
+         * @brief Clears the variable if it's a vector, or assigns it a
+         *      default constructed value if it isn't.
+         */
+        virtual void clear() = 0;
+    };
+
+    /**
+     * @brief Assigns values of enum type T to a variable.
+     *
+     * The values on the command line must match one of the names in
+     * the list given to the constructor exactly.
+     */
+    template <typename T>
+    class EnumBinding : public IValueBinding
+    {
+    public:
+        static_assert(std::is_enum_v<T>);
+
+        EnumBinding(T* target, std::vector<std::pair<std::string, T>> values)
+            : m_target(target),
+              m_values(std::move(values))
+        {}
+
+        bool assign(std::string_view value) override
+        {
+            for (const auto& [name, v] : m_values)
+            {
+                if (name == value)
+                {
+                    *m_target = v;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool append(std::string_view value) override
+        {
+            return assign(value);
+        }
+
+        void clear() override
+        {
+            *m_target = T();
+        }
+    private:
+        T* m_target;
+        std::vector<std::pair<std::string, T>> m_values;
+    };
+
+    /**
+     * @brief Converts @a str with the same rules as ArgumentValue's
+     *      as_bool, as_int, as_double etc. and assigns the result to
+     *      @a value.
+     *
+     * @return false, and leaves @a value unchanged, if @a str can't be
+     *      converted.
+     * @{
+     */
+    bool parse_value(std::string_view str, bool& value);
+
+    bool parse_value(std::string_view str, int& value);
+
+    bool parse_value(std::string_view str, unsigned& value);
+
+    bool parse_value(std::string_view str, long& value);
+
+    bool parse_value(std::string_view str, unsigned long& value);
+
+    bool parse_value(std::string_view str, long long& value);
+
+    bool parse_value(std::string_view str, unsigned long long& value);
+
+    bool parse_value(std::string_view str, float& value);
+
+    bool parse_value(std::string_view str, double& value);
+
+    bool parse_value(std::string_view str, std::string& value);
+    /** @} */
+
+    /**
+     * @brief Creates a binding that converts values with the same rules
+     *      as ArgumentValue's as_bool, as_int, as_double etc.
+     * @{
+     */
+    std::shared_ptr<IValueBinding> make_value_binding(bool* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(int* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(unsigned* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(long* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(unsigned long* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(long long* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(unsigned long long* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(float* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(double* target);
+
+    std::shared_ptr<IValueBinding> make_value_binding(std::string* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<bool>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<int>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<unsigned>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<long>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<unsigned long>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<long long>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<unsigned long long>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<float>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<double>* target);
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<std::string>* target);
+    /** @} */
+}
@@ -0,0 +1,79 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include "Enums.hpp"
+
+/**
+ * @file
+ * @brief Defines the ValueHandle class.
+ */
+
+namespace argos
+{
+    /**
+     * @brief Identifies the value of an argument or option.
+     *
+     * Retrieving a value from ParsedArguments with a handle is a direct
+     * index, while retrieving it by name requires a search among the
+     * names of all the arguments and options. Programs that parse many
+     * command lines with the same parser can get the handles once with
+     * ArgumentParser::value_handle and use them with every
+     * ParsedArguments instance the parser returns.
+     *
+     * A handle is only valid with the parser it was created by, and
+     * becomes invalid if the parser is modified. Using an invalid handle
+     * throws ArgosException.
+     */
+    class ValueHandle
+    {
+    public:
+        /**
+         * @brief Creates an invalid handle.
+         */
+        constexpr ValueHandle() = default;
+
+        /**
+         * @private
+         */
+        constexpr ValueHandle(ValueId value_id, size_t generation)
+            : m_value_id(value_id),
+              m_generation(generation)
+        {}
+
+        /**
+         * @brief Returns the ID of the value.
+         */
+        [[nodiscard]] constexpr ValueId value_id() const
+        {
+            return m_value_id;
+        }
+
+        /**
+         * @private
+         * @brief Identifies the parser definition the handle was
+         *      created for.
+         */
+        [[nodiscard]] constexpr size_t generation() const
+        {
+            return m_generation;
+        }
+
+        /**
+         * @brief Returns true unless the handle was default constructed.
+         */
+        constexpr explicit operator bool() const
+        {
+            return m_value_id != ValueId{};
+        }
+    private:
+        ValueId m_value_id = {};
+        size_t m_generation = 0;
+    };
+}
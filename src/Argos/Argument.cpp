@@ -59,10 +59,11 @@ namespace argos
         return *this;
     }
 
-    Argument& Argument::help(TextCallback callback)
+    Argument& Argument::help(TextCallback callback,
+                             TextCallbackMode mode)
     {
         check_argument();
-        m_argument->help = callback;
+        m_argument->help = make_text_source(std::move(callback), mode);
         return *this;
     }
 
@@ -87,6 +88,13 @@ namespace argos
         return *this;
     }
 
+    Argument& Argument::bind(std::shared_ptr<IValueBinding> binding)
+    {
+        check_argument();
+        m_argument->binding = std::move(binding);
+        return *this;
+    }
+
     Argument& Argument::visibility(Visibility visibility)
     {
         check_argument();
@@ -45,10 +45,10 @@ namespace argos
             }
         }
 
-        std::vector<std::pair<size_t, const ArgumentData*>>
-        make_argument_counters(
+        void make_argument_counters(
             const std::vector<std::unique_ptr<ArgumentData>>& arguments,
-            size_t n)
+            size_t n,
+            std::vector<std::pair<size_t, const ArgumentData*>>& counters)
         {
             auto minmax = ArgumentCounter::get_min_max_count(arguments);
             if (n < minmax.first)
@@ -58,25 +58,23 @@ namespace argos
             else
                 n -= minmax.first;
 
-            std::vector<std::pair<size_t, const ArgumentData*>> result;
             for (auto& arg : arguments)
             {
                 if (n == 0 || arg->min_count == arg->max_count)
                 {
-                    result.emplace_back(arg->min_count, arg.get());
+                    counters.emplace_back(arg->min_count, arg.get());
                 }
                 else if (arg->min_count + n <= arg->max_count)
                 {
-                    result.emplace_back(arg->min_count + n, arg.get());
+                    counters.emplace_back(arg->min_count + n, arg.get());
                     n = 0;
                 }
                 else
                 {
-                    result.emplace_back(arg->max_count, arg.get());
+                    counters.emplace_back(arg->max_count, arg.get());
                     n -= arg->max_count - arg->min_count;
                 }
             }
-            return result;
         }
     }
 
@@ -93,9 +91,30 @@ namespace argos
     ArgumentCounter::ArgumentCounter(
         const std::vector<std::unique_ptr<ArgumentData>>& arguments,
         size_t argument_count)
-        : m_counters(make_argument_counters(arguments, argument_count)),
-          m_first_optional(m_counters.size())
-    {}
+    {
+        make_argument_counters(arguments, argument_count, m_counters);
+        m_first_optional = m_counters.size();
+    }
+
+    void ArgumentCounter::reset(
+        const std::vector<std::unique_ptr<ArgumentData>>& arguments)
+    {
+        m_counters.clear();
+        make_argument_counters(arguments, m_counters, m_first_optional);
+        m_index = 0;
+        m_counter = 0;
+    }
+
+    void ArgumentCounter::reset(
+        const std::vector<std::unique_ptr<ArgumentData>>& arguments,
+        size_t argument_count)
+    {
+        m_counters.clear();
+        make_argument_counters(arguments, argument_count, m_counters);
+        m_first_optional = m_counters.size();
+        m_index = 0;
+        m_counter = 0;
+    }
 
     const ArgumentData* ArgumentCounter::next_argument()
     {
@@ -154,4 +173,17 @@ namespace argos
         }
         return false;
     }
+
+    size_t ArgumentCounter::get_fixed_count(
+            const std::vector<std::unique_ptr<ArgumentData>>& arguments)
+    {
+        size_t result = 0;
+        for (auto& arg : arguments)
+        {
+            if (arg->min_count != arg->max_count)
+                break;
+            result += arg->max_count;
+        }
+        return result;
+    }
 }
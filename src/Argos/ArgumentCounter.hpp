@@ -24,6 +24,13 @@ namespace argos
                 const std::vector<std::unique_ptr<ArgumentData>>& arguments,
                 size_t argument_count);
 
+        // The reset functions are equivalent to assigning a new
+        // ArgumentCounter, but reuse the memory of the existing one.
+        void reset(const std::vector<std::unique_ptr<ArgumentData>>& arguments);
+
+        void reset(const std::vector<std::unique_ptr<ArgumentData>>& arguments,
+                   size_t argument_count);
+
         const ArgumentData* next_argument();
 
         [[nodiscard]] size_t count() const;
@@ -35,6 +42,9 @@ namespace argos
 
         static bool requires_argument_count(
                 const std::vector<std::unique_ptr<ArgumentData>>& arguments);
+
+        static size_t get_fixed_count(
+                const std::vector<std::unique_ptr<ArgumentData>>& arguments);
     private:
         using Counter = std::pair<size_t, const ArgumentData*>;
         std::vector<Counter> m_counters;
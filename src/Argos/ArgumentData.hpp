@@ -9,6 +9,7 @@
 #include <string>
 #include "Argos/Callbacks.hpp"
 #include "Argos/Enums.hpp"
+#include "Argos/ValueBinding.hpp"
 #include "TextSource.hpp"
 
 namespace argos
@@ -20,6 +21,7 @@ namespace argos
         std::string section;
         std::string value;
         ArgumentCallback callback;
+        std::shared_ptr<IValueBinding> binding;
         unsigned min_count = 1;
         unsigned max_count = 1;
         Visibility visibility = Visibility::NORMAL;
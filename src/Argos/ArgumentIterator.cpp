@@ -12,12 +12,20 @@
 
 namespace argos
 {
-    ArgumentIterator::ArgumentIterator(std::vector<std::string_view> args,
-                                       std::shared_ptr<ParserData> parser_data)
+    ArgumentIterator::ArgumentIterator(
+            std::vector<std::string_view> args,
+            std::shared_ptr<const ParserData> parser_data)
         : m_impl(std::make_unique<ArgumentIteratorImpl>(std::move(args),
                                                         std::move(parser_data)))
     {}
 
+    ArgumentIterator::ArgumentIterator(
+            std::unique_ptr<IArgumentSource> source,
+            std::shared_ptr<const ParserData> parser_data)
+        : m_impl(std::make_unique<ArgumentIteratorImpl>(std::move(source),
+                                                        std::move(parser_data)))
+    {}
+
     ArgumentIterator::ArgumentIterator(ArgumentIterator&& rhs) noexcept
         : m_impl(std::move(rhs.m_impl))
     {}
@@ -65,6 +73,11 @@ namespace argos
         return ParsedArguments(impl().parsed_arguments());
     }
 
+    std::vector<std::string_view> ArgumentIterator::remaining_arguments()
+    {
+        return impl().remaining_arguments();
+    }
+
     ArgumentIteratorImpl& ArgumentIterator::impl()
     {
         if (!m_impl)
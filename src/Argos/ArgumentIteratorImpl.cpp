@@ -8,100 +8,44 @@
 #include "ArgumentIteratorImpl.hpp"
 
 #include <algorithm>
+#include "Argos/ArgumentParser.hpp"
 #include "ArgosThrow.hpp"
 #include "HelpText.hpp"
 #include "StringUtilities.hpp"
 #include "OptionIterator.hpp"
+#include "ParseValue.hpp"
 
 namespace argos
 {
     namespace
     {
-        using OptionTable = std::vector<std::pair<std::string_view, const OptionData*>>;
-
-        OptionTable make_option_index(
-                const std::vector<std::unique_ptr<OptionData>>& options,
-                bool case_insensitive)
-        {
-            OptionTable index;
-            for (auto& option : options)
-            {
-                for (auto& flag : option->flags)
-                    index.emplace_back(flag, option.get());
-            }
-
-            sort(index.begin(), index.end(), [&](const auto& a, const auto& b)
-            {
-                return is_less(a.first, b.first, case_insensitive);
-            });
-
-            auto it = adjacent_find(index.begin(), index.end(),
-                                    [&](const auto& a, const auto& b)
-            {
-                return are_equal(a.first, b.first, case_insensitive);
-            });
-
-            if (it == index.end())
-                return index;
-
-            if (it->first == next(it)->first)
-            {
-                ARGOS_THROW("Multiple definitions of flag "
-                            + std::string(it->first));
-            }
-            else
-            {
-                ARGOS_THROW("Conflicting flags: " + std::string(it->first)
-                            + " and " + std::string(next(it)->first));
-            }
-        }
-
-        const OptionData* find_option_impl(const OptionTable& options,
+        const OptionData* find_option_impl(const FlagIndex& flags,
                                            std::string_view arg,
-                                           bool allow_abbreviations,
-                                           bool case_insensitive)
-        {
-            auto it = std::lower_bound(
-                options.begin(), options.end(),
-                OptionTable::value_type(arg, nullptr),
-                [&](auto& a, auto& b)
-                {return is_less(a.first, b.first, case_insensitive);});
-            if (it == options.end())
-                return nullptr;
-            if (it->first == arg)
-                return it->second;
-            if (case_insensitive && are_equal_ci(it->first, arg))
-                return it->second;
+                                           bool allow_abbreviations)
+        {
+            if (auto option = flags.find(arg))
+                return option;
             if (!allow_abbreviations)
                 return nullptr;
-            if (!starts_with(it->first, arg, case_insensitive))
-                return nullptr;
-            auto nxt = next(it);
-            if (nxt != options.end()
-                && starts_with(nxt->first, arg, case_insensitive))
-                return nullptr;
-            return it->second;
+            return flags.find_abbreviated(arg);
         }
 
-        const OptionData* find_option(const OptionTable& options,
+        const OptionData* find_option(const FlagIndex& flags,
                                       std::string_view arg,
-                                      bool allow_abbreviations,
-                                      bool case_insensitive)
+                                      bool allow_abbreviations)
         {
-            auto opt = find_option_impl(options, arg, allow_abbreviations,
-                                        case_insensitive);
+            auto opt = find_option_impl(flags, arg, allow_abbreviations);
             if (opt == nullptr && arg.size() > 2 && arg.back() == '=')
             {
                 arg = arg.substr(0, arg.size() - 1);
-                opt = find_option_impl(options, arg, allow_abbreviations,
-                                       case_insensitive);
+                opt = find_option_impl(flags, arg, allow_abbreviations);
                 if (opt && opt->argument.empty())
                     opt = nullptr;
             }
             return opt;
         }
 
-        bool is_option(const std::string& s, OptionStyle style)
+        bool is_option(std::string_view s, OptionStyle style)
         {
             if (s.size() < 2)
                 return false;
@@ -123,20 +67,152 @@ namespace argos
                 return std::make_unique<StandardOptionIterator>(std::move(args));
             }
         }
+
+        std::unique_ptr<IOptionIterator>
+        make_option_iterator(OptionStyle style,
+                             std::unique_ptr<IArgumentSource> source)
+        {
+            switch (style)
+            {
+            case OptionStyle::SLASH:
+                return std::make_unique<OptionIterator>(std::move(source), '/');
+            case OptionStyle::DASH:
+                return std::make_unique<OptionIterator>(std::move(source), '-');
+            default:
+                return std::make_unique<StandardOptionIterator>(std::move(source));
+            }
+        }
+
+        bool has_response_files(const std::vector<std::string_view>& args)
+        {
+            return std::any_of(args.begin(), args.end(), [](auto arg)
+            {
+                return arg.size() > 1 && arg[0] == '@';
+            });
+        }
+    }
+
+    ArgumentIteratorImpl::ArgumentIteratorImpl(
+            std::vector<std::string_view> args,
+            std::shared_ptr<const ParserData> data)
+        : m_data(std::move(data)),
+          m_parsed_args(std::make_shared<ParsedArgumentsImpl>(m_data))
+    {
+        initialize(args);
     }
 
-    ArgumentIteratorImpl::ArgumentIteratorImpl(std::vector<std::string_view> args,
-                                               std::shared_ptr<ParserData> data)
+    ArgumentIteratorImpl::ArgumentIteratorImpl(
+            std::string_view command_line,
+            std::shared_ptr<const ParserData> data)
+        : m_data(std::move(data)),
+          m_parsed_args(std::make_shared<ParsedArgumentsImpl>(m_data))
+    {
+        std::vector<std::string_view> args;
+        m_parsed_args->store_command_line(command_line, args);
+        initialize(args);
+    }
+
+    ArgumentIteratorImpl::ArgumentIteratorImpl(
+            std::unique_ptr<IArgumentSource> source,
+            std::shared_ptr<const ParserData> data)
         : m_data(std::move(data)),
-          m_options(make_option_index(m_data->options,
-                                      m_data->parser_settings.case_insensitive)),
           m_parsed_args(std::make_shared<ParsedArgumentsImpl>(m_data)),
           m_iterator(make_option_iterator(m_data->parser_settings.option_style,
-                                          std::move(args)))
+                                          std::move(source))),
+          m_retain_arguments(false)
+    {
+        initialize();
+    }
+
+    void ArgumentIteratorImpl::reset(const std::vector<std::string_view>& args,
+                                     std::shared_ptr<const ParserData> data)
     {
-        for (const auto& option : m_data->options)
+        reset_state(std::move(data));
+        m_args.assign(args.begin(), args.end());
+        initialize(m_args);
+    }
+
+    void ArgumentIteratorImpl::reset(std::string_view command_line,
+                                     std::shared_ptr<const ParserData> data)
+    {
+        reset_state(std::move(data));
+        m_parsed_args->store_command_line(command_line, m_args);
+        initialize(m_args);
+    }
+
+    void ArgumentIteratorImpl::reset_state(
+        std::shared_ptr<const ParserData> data)
+    {
+        if (m_data != data)
         {
-            if (!option->initial_value.empty())
+            // The option iterator depends on the option style.
+            m_iterator.reset();
+            m_data = std::move(data);
+            m_parsed_args = std::make_shared<ParsedArgumentsImpl>(m_data);
+        }
+        else if (m_parsed_args.use_count() != 1)
+        {
+            m_parsed_args = std::make_shared<ParsedArgumentsImpl>(m_data);
+        }
+        else
+        {
+            m_parsed_args->clear();
+        }
+
+        m_retain_arguments = true;
+        m_argument_index = 0;
+        m_fixed_count = SIZE_MAX;
+        m_max_count = SIZE_MAX;
+        m_deferred_arguments.clear();
+        m_deferred_index = 0;
+        m_final_result.reset();
+        m_state = State::ARGUMENTS_AND_OPTIONS;
+    }
+
+    void ArgumentIteratorImpl::initialize(std::vector<std::string_view>& args)
+    {
+        std::string response_file_error;
+        if (m_data->parser_settings.expand_response_files
+            && has_response_files(args))
+        {
+            auto files = std::make_unique<ResponseFiles>();
+            auto expanded_args = files->expand(args);
+            if (files->error().empty())
+                args = std::move(expanded_args);
+            else
+                response_file_error = files->error();
+            if (!files->empty())
+                m_parsed_args->set_response_files(std::move(files));
+        }
+
+        if (m_iterator)
+            m_iterator->reset(args);
+        else
+            m_iterator = make_option_iterator(
+                m_data->parser_settings.option_style, std::move(args));
+        initialize();
+
+        if (!response_file_error.empty() && !m_final_result)
+        {
+            error(response_file_error);
+            m_final_result = {IteratorResultCode::ERROR, nullptr, {}};
+        }
+    }
+
+    void ArgumentIteratorImpl::initialize()
+    {
+        for (const auto* option : m_data->initial_value_options)
+        {
+            if (auto* binding = find_value_binding(*m_data, option->value_id))
+            {
+                if (!bind_value(*binding, *option, option->initial_value,
+                                true, option->flags.front()))
+                {
+                    m_final_result = {IteratorResultCode::ERROR, nullptr, {}};
+                    return;
+                }
+            }
+            else
             {
                 m_parsed_args->append_value(option->value_id,
                                             option->initial_value,
@@ -144,57 +220,109 @@ namespace argos
             }
         }
 
-        if (!ArgumentCounter::requires_argument_count(m_data->arguments))
-            m_argument_counter = ArgumentCounter(m_data->arguments);
-        else
-            m_argument_counter = ArgumentCounter(m_data->arguments,
-                                                 count_arguments());
+        m_argument_counter.reset(m_data->arguments);
+        if (ArgumentCounter::requires_argument_count(m_data->arguments))
+        {
+            m_fixed_count = ArgumentCounter::get_fixed_count(
+                m_data->arguments);
+            m_max_count = ArgumentCounter::get_min_max_count(
+                m_data->arguments).second;
+        }
     }
 
-    std::shared_ptr<ParsedArgumentsImpl>
-    ArgumentIteratorImpl::parse(std::vector<std::string_view> args,
-                                const std::shared_ptr<ParserData>& data)
+    std::shared_ptr<ParsedArgumentsImpl> ArgumentIteratorImpl::parse_all()
     {
-        ArgumentIteratorImpl iterator(std::move(args), data);
         while (true)
         {
-            auto code = std::get<0>(iterator.next());
+            auto code = std::get<0>(next());
             if (code == IteratorResultCode::ERROR
                 || code == IteratorResultCode::DONE)
             {
                 break;
             }
         }
-        return iterator.m_parsed_args;
+        return m_parsed_args;
+    }
+
+    std::shared_ptr<ParsedArgumentsImpl>
+    ArgumentIteratorImpl::parse(std::vector<std::string_view> args,
+                                const std::shared_ptr<const ParserData>& data)
+    {
+        return ArgumentIteratorImpl(std::move(args), data).parse_all();
+    }
+
+    std::shared_ptr<ParsedArgumentsImpl>
+    ArgumentIteratorImpl::parse(std::string_view command_line,
+                                const std::shared_ptr<const ParserData>& data)
+    {
+        return ArgumentIteratorImpl(command_line, data).parse_all();
     }
 
     IteratorResult ArgumentIteratorImpl::next()
     {
+        if (m_final_result)
+            return next_deferred_result();
         if (m_state == State::ERROR)
             ARGOS_THROW("next() called after error.");
         if (m_state == State::DONE)
             return {IteratorResultCode::DONE, nullptr, {}};
 
-        auto arg = m_state == State::ARGUMENTS_AND_OPTIONS
-                   ? m_iterator->next()
-                   : m_iterator->next_value();
-        if (!arg)
+        while (true)
         {
-            if (check_argument_and_option_counts())
-                return {IteratorResultCode::DONE, nullptr, {}};
+            std::string_view arg;
+            if (m_state == State::ARGUMENTS_ONLY)
+            {
+                auto value = m_iterator->next_value();
+                if (!value)
+                    break;
+                arg = *value;
+            }
+            else if (auto token = m_iterator->next())
+            {
+                if (is_option(*token, m_data->parser_settings.option_style))
+                    return process_option(*token);
+                // Tokens that aren't options are always complete arguments,
+                // current() returns them as views into the argument list.
+                arg = m_iterator->current();
+            }
             else
-                return {IteratorResultCode::ERROR, nullptr, {}};
-        }
+            {
+                break;
+            }
 
-        if (m_state == State::ARGUMENTS_AND_OPTIONS
-            && is_option(*arg, m_data->parser_settings.option_style))
-        {
-            return process_option(*arg);
+            if (!m_data->subcommands.empty())
+            {
+                if (!process_subcommand(arg))
+                    return {IteratorResultCode::ERROR, nullptr, {}};
+                break;
+            }
+
+            // When the number of values for some of the arguments depends
+            // on the total number of arguments, only the leading arguments
+            // with fixed counts can be assigned immediately. The remaining
+            // ones are assigned when all arguments have been read.
+            auto index = m_argument_index++;
+            if (index < m_fixed_count)
+                return process_argument(m_argument_counter.next_argument(),
+                                        arg);
+            if (index >= m_max_count)
+                return process_argument(nullptr, arg);
+            // Arguments from a source must be copied, the source reuses
+            // its buffers.
+            if (m_retain_arguments)
+                m_deferred_arguments.push_back(arg);
+            else
+                m_deferred_arguments.push_back(m_parsed_args->store_string(arg));
         }
+
+        if (!assign_deferred_arguments())
+            return {IteratorResultCode::ERROR, nullptr, {}};
+        if (check_argument_and_option_counts())
+            return report_deferred_results({IteratorResultCode::DONE,
+                                            nullptr, {}});
         else
-        {
-            return process_argument(*arg);
-        }
+            return report_deferred_results({IteratorResultCode::ERROR,
+                                            nullptr, {}});
     }
 
     const std::shared_ptr<ParsedArgumentsImpl>&
@@ -205,48 +333,76 @@ namespace argos
 
     std::pair<ArgumentIteratorImpl::OptionResult, std::string_view>
     ArgumentIteratorImpl::process_option(const OptionData& opt,
-                                         const std::string& flag)
+                                         std::string_view flag)
     {
         std::string_view arg;
         switch (opt.operation)
         {
         case OptionOperation::ASSIGN:
-            if (!opt.constant.empty())
+        case OptionOperation::APPEND:
+        {
+            const bool append = opt.operation == OptionOperation::APPEND;
+            std::optional<std::string_view> value;
+            if (opt.constant.empty())
             {
-                m_parsed_args->assign_value(opt.value_id, opt.constant,
-                                            opt.argument_id);
+                value = m_iterator->next_value();
+                if (!value)
+                {
+                    error(std::string(flag) + ": no value given.");
+                    return {OptionResult::ERROR, {}};
+                }
             }
-            else if (auto value = m_iterator->next_value())
+
+            if (auto* binding = find_value_binding(*m_data, opt.value_id))
             {
-                arg = m_parsed_args->assign_value(opt.value_id, *value,
-                                                  opt.argument_id);
+                if (!bind_value(*binding, opt, value ? *value : opt.constant,
+                                append, flag))
+                {
+                    return {OptionResult::ERROR, {}};
+                }
+                if (value)
+                    arg = *value;
             }
-            else
+            else if (value)
             {
-                error(flag + ": no value given.");
-                return {OptionResult::ERROR, {}};
+                auto stored = m_parsed_args->store_argument(*value);
+                arg = append
+                      ? m_parsed_args->append_value(opt.value_id, stored,
+                                                    opt.argument_id)
+                      : m_parsed_args->assign_value(opt.value_id, stored,
+                                                    opt.argument_id);
             }
-            break;
-        case OptionOperation::APPEND:
-            if (!opt.constant.empty())
+            else if (append)
             {
                 m_parsed_args->append_value(opt.value_id, opt.constant,
                                             opt.argument_id);
             }
-            else if (auto value = m_iterator->next_value())
-            {
-                arg = m_parsed_args->append_value(opt.value_id, *value,
-                                                  opt.argument_id);
-            }
             else
             {
-                error(flag + ": no value given.");
-                return {OptionResult::ERROR, {}};
+                m_parsed_args->assign_value(opt.value_id, opt.constant,
+                                            opt.argument_id);
             }
             break;
+        }
         case OptionOperation::CLEAR:
+            if (auto* binding = find_value_binding(*m_data, opt.value_id))
+                binding->clear();
             m_parsed_args->clear_value(opt.value_id);
             break;
+        case OptionOperation::COUNT:
+        {
+            auto* binding = find_value_binding(*m_data, opt.value_id);
+            auto count = m_parsed_args->count_value(
+                opt.value_id, opt.count_step, opt.min_count, opt.max_count,
+                opt.argument_id, binding != nullptr);
+            if (binding && !binding->assign(count))
+            {
+                error(std::string(flag) + ": invalid value \""
+                      + std::string(count) + "\".");
+                return {OptionResult::ERROR, {}};
+            }
+            break;
+        }
         case OptionOperation::NONE:
             break;
         }
@@ -268,7 +424,8 @@ namespace argos
         case OptionType::NORMAL:
             return {OptionResult::NORMAL, arg};
         case OptionType::HELP:
-            write_help_text(*m_data);
+            if (m_data->parser_settings.write_help_texts)
+                write_help_text(*m_data);
             [[fallthrough]];
         case OptionType::EXIT:
             m_state = State::DONE;
@@ -289,12 +446,11 @@ namespace argos
     }
 
     IteratorResult
-    ArgumentIteratorImpl::process_option(const std::string& flag)
+    ArgumentIteratorImpl::process_option(std::string_view flag)
     {
         auto option = find_option(
-            m_options, flag,
-            m_data->parser_settings.allow_abbreviated_options,
-            m_data->parser_settings.case_insensitive);
+            m_data->flag_index, flag,
+            m_data->parser_settings.allow_abbreviated_options);
         if (option)
         {
             auto opt_res = process_option(*option, flag);
@@ -303,20 +459,32 @@ namespace argos
             case OptionResult::EXIT:
                 if (m_data->parser_settings.auto_exit)
                     exit(m_data->parser_settings.normal_exit_code);
+                if (!assign_deferred_arguments())
+                    return {IteratorResultCode::ERROR, nullptr, {}};
                 copy_remaining_arguments_to_parser_result();
-                return {IteratorResultCode::OPTION, option, opt_res.second};
+                break;
             case OptionResult::ERROR:
                 return {IteratorResultCode::ERROR, option, {}};
             case OptionResult::LAST_ARGUMENT:
-                if (!check_argument_and_option_counts())
+                if (!assign_deferred_arguments())
                     return {IteratorResultCode::ERROR, nullptr, {}};
-                [[fallthrough]];
+                if (!check_argument_and_option_counts())
+                {
+                    return report_deferred_results(
+                        {IteratorResultCode::ERROR, nullptr, {}});
+                }
+                copy_remaining_arguments_to_parser_result();
+                break;
             case OptionResult::STOP:
+                if (!assign_deferred_arguments())
+                    return {IteratorResultCode::ERROR, nullptr, {}};
                 copy_remaining_arguments_to_parser_result();
-                [[fallthrough]];
+                break;
             default:
                 return {IteratorResultCode::OPTION, option, opt_res.second};
             }
+            return report_deferred_results(
+                {IteratorResultCode::OPTION, option, opt_res.second});
         }
         if (!m_data->parser_settings.ignore_undefined_options
             || !starts_with(m_iterator->current(), flag))
@@ -326,19 +494,33 @@ namespace argos
         }
         else
         {
-            m_parsed_args->add_unprocessed_argument(
-                std::string(m_iterator->current()));
+            m_parsed_args->add_unprocessed_argument(m_iterator->current());
             return {IteratorResultCode::UNKNOWN, nullptr, m_iterator->current()};
         }
     }
 
     IteratorResult
-    ArgumentIteratorImpl::process_argument(const std::string& name)
+    ArgumentIteratorImpl::process_argument(const ArgumentData* argument,
+                                           std::string_view name)
     {
-        if (auto argument = m_argument_counter.next_argument())
+        if (argument)
         {
-            auto s = m_parsed_args->append_value(argument->value_id, name,
-                                                 argument->argument_id);
+            auto s = name;
+            if (auto* binding = find_value_binding(*m_data,
+                                                   argument->value_id))
+            {
+                if (!bind_value(*binding, *argument, name, true,
+                                argument->name))
+                {
+                    return {IteratorResultCode::ERROR, nullptr, {}};
+                }
+            }
+            else if (m_retain_arguments)
+            {
+                s = m_parsed_args->append_value(
+                    argument->value_id, m_parsed_args->store_argument(name),
+                    argument->argument_id);
+            }
             if (argument->callback)
             {
                 argument->callback(ArgumentView(argument), s,
@@ -358,61 +540,177 @@ namespace argos
         }
         else
         {
-            error("Too many arguments, starting with \"" + name + "\".");
+            error("Too many arguments, starting with \""
+                  + std::string(name) + "\".");
             return {IteratorResultCode::ERROR, nullptr, {}};
         }
         return {IteratorResultCode::UNKNOWN, nullptr, m_iterator->current()};
     }
 
+    bool ArgumentIteratorImpl::process_subcommand(std::string_view name)
+    {
+        const auto index = find_subcommand(*m_data, name);
+        if (!index)
+        {
+            error("Unknown command: " + std::string(name));
+            return false;
+        }
+        const auto* subcommand = m_data->subcommands[*index].get();
+
+        // Arguments from a source must be copied, the source reuses
+        // its buffers. This means that all of them are kept in memory.
+        std::vector<std::string_view> args;
+        while (true)
+        {
+            auto batch = m_iterator->remaining_arguments();
+            if (batch.empty())
+                break;
+            for (auto arg : batch)
+                args.push_back(m_retain_arguments
+                               ? arg
+                               : m_parsed_args->store_string(arg));
+        }
+
+        ParsedArguments result(ArgumentIteratorImpl::parse(
+            std::move(args), get_subcommand_data(*m_data, *index)));
+        const auto code = result.result_code();
+        std::string message;
+        if (code == ParserResultCode::FAILURE)
+            message = result.error_message();
+        m_parsed_args->set_subcommand(subcommand, std::move(result));
+        m_state = State::DONE;
+
+        // The subcommand's parser has already written any error message.
+        if (code == ParserResultCode::FAILURE)
+        {
+            m_parsed_args->set_error_message(std::move(message));
+            m_parsed_args->set_result_code(ParserResultCode::FAILURE);
+            m_state = State::ERROR;
+            return false;
+        }
+        return true;
+    }
+
+    std::vector<std::string_view> ArgumentIteratorImpl::remaining_arguments()
+    {
+        if (m_state != State::DONE && m_state != State::ERROR)
+        {
+            ARGOS_THROW("The remaining arguments are only available after"
+                        " the last argument has been processed.");
+        }
+        return m_iterator->remaining_arguments();
+    }
+
     void ArgumentIteratorImpl::copy_remaining_arguments_to_parser_result()
     {
-        for (auto str : m_iterator->remaining_arguments())
-            m_parsed_args->add_unprocessed_argument(std::string(str));
+        // A source can be arbitrarily long, its remaining arguments are
+        // left for remaining_arguments().
+        if (!m_retain_arguments)
+            return;
+
+        while (true)
+        {
+            auto args = m_iterator->remaining_arguments();
+            if (args.empty())
+                break;
+            for (auto str : args)
+                m_parsed_args->add_unprocessed_argument(str);
+        }
     }
 
-    size_t ArgumentIteratorImpl::count_arguments() const
+    bool ArgumentIteratorImpl::assign_deferred_arguments()
     {
-        size_t result = 0;
-        std::unique_ptr<IOptionIterator> it(m_iterator->clone());
-        bool arguments_only = false;
-        for (auto arg = it->next(); arg && !arguments_only; arg = it->next())
-        {
-            auto option = find_option(m_options, *arg,
-                                      m_data->parser_settings.allow_abbreviated_options,
-                                      m_data->parser_settings.case_insensitive);
-            if (option)
-            {
-                if (!option->argument.empty())
-                    it->next_value();
-                switch (option->type)
-                {
-                case OptionType::HELP:
-                case OptionType::LAST_ARGUMENT:
-                case OptionType::STOP:
-                    return result;
-                case OptionType::LAST_OPTION:
-                    arguments_only = true;
-                    break;
-                default:
-                    break;
-                }
-            }
-            else if (!is_option(*arg, m_data->parser_settings.option_style))
+        if (m_fixed_count == SIZE_MAX)
+            return true;
+
+        // Now that the total number of arguments is known, the argument
+        // counter can distribute the deferred arguments. The leading
+        // arguments have already been assigned and are skipped.
+        m_argument_counter.reset(m_data->arguments, m_argument_index);
+        for (size_t i = 0; i < std::min(m_fixed_count, m_argument_index); ++i)
+            m_argument_counter.next_argument();
+
+        // The deferred arguments are reported by subsequent calls to
+        // next(), a copy of the counter recreates their ArgumentData.
+        m_deferred_counter = m_argument_counter;
+        m_fixed_count = SIZE_MAX;
+        for (auto& arg : m_deferred_arguments)
+        {
+            auto result = process_argument(m_argument_counter.next_argument(),
+                                           arg);
+            if (std::get<0>(result) == IteratorResultCode::ERROR)
             {
-                ++result;
+                m_deferred_arguments.clear();
+                return false;
             }
+            arg = std::get<2>(result);
+        }
+        return true;
+    }
+
+    IteratorResult
+    ArgumentIteratorImpl::report_deferred_results(IteratorResult result)
+    {
+        if (m_deferred_arguments.empty())
+            return result;
+        m_final_result = result;
+        return next_deferred_result();
+    }
+
+    IteratorResult ArgumentIteratorImpl::next_deferred_result()
+    {
+        if (m_deferred_index != m_deferred_arguments.size())
+        {
+            auto arg = m_deferred_arguments[m_deferred_index++];
+            return {IteratorResultCode::ARGUMENT,
+                    m_deferred_counter.next_argument(), arg};
         }
 
-        for (auto arg = it->next(); arg; arg = it->next())
-            ++result;
+        auto result = *m_final_result;
+        m_final_result.reset();
+        m_deferred_arguments.clear();
+        m_deferred_index = 0;
         return result;
     }
 
+    template <typename Data>
+    bool ArgumentIteratorImpl::bind_value(IValueBinding& binding,
+                                          const Data& data,
+                                          std::string_view value,
+                                          bool append,
+                                          std::string_view name)
+    {
+        // The first value replaces the variable's current value, also
+        // when it's a vector.
+        const bool ok = append && m_parsed_args->has(data.value_id)
+                        ? binding.append(value)
+                        : binding.assign(value);
+        if (!ok)
+        {
+            error(std::string(name) + ": invalid value \""
+                  + std::string(value) + "\".");
+            return false;
+        }
+
+        // Only the fact that the value was given is stored.
+        if (append)
+            m_parsed_args->append_value(data.value_id, {}, data.argument_id);
+        else
+            m_parsed_args->assign_value(data.value_id, {}, data.argument_id);
+        // A COUNT-option that shares the value continues from it.
+        if (is_counted_bound_value(*m_data, data.value_id))
+        {
+            if (auto n = parse_integer<long long>(value, 10))
+                m_parsed_args->set_bound_count(data.value_id, *n);
+        }
+        return true;
+    }
+
     bool ArgumentIteratorImpl::check_argument_and_option_counts()
     {
-        for (auto& o : m_data->options)
+        for (const auto* o : m_data->mandatory_options)
         {
-            if (!o->optional && !m_parsed_args->has(o->value_id))
+            if (!m_parsed_args->has(o->value_id))
             {
                 auto flags = o->flags.front();
                 for (unsigned i = 1; i < o->flags.size(); ++i)
@@ -421,10 +719,24 @@ namespace argos
                 return false;
             }
         }
+        if (!m_data->subcommands.empty() && !m_parsed_args->subcommand())
+        {
+            error("No command given.");
+            return false;
+        }
         if (m_argument_counter.is_complete())
         {
             m_state = State::DONE;
-            m_parsed_args->set_result_code(ParserResultCode::SUCCESS);
+            const auto* subcommand = m_parsed_args->subcommand();
+            if (subcommand && m_parsed_args->subcommand_arguments()
+                                  .result_code() == ParserResultCode::STOP)
+            {
+                m_parsed_args->set_result_code(ParserResultCode::STOP);
+            }
+            else
+            {
+                m_parsed_args->set_result_code(ParserResultCode::SUCCESS);
+            }
             return true;
         }
         else
@@ -441,7 +753,8 @@ namespace argos
 
     void ArgumentIteratorImpl::error(const std::string& message)
     {
-        if (!message.empty())
+        m_parsed_args->set_error_message(message);
+        if (!message.empty() && m_data->parser_settings.write_error_messages)
             write_error_message(*m_data, message);
         if (m_data->parser_settings.auto_exit)
             exit(m_data->parser_settings.error_exit_code);
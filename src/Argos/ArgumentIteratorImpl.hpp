@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <cstdint>
 #include <string>
 #include "ArgumentCounter.hpp"
 #include "ParserData.hpp"
@@ -33,16 +34,48 @@ namespace argos
     {
     public:
         ArgumentIteratorImpl(std::vector<std::string_view> args,
-                             std::shared_ptr<ParserData> data);
+                             std::shared_ptr<const ParserData> data);
+
+        // The arguments are views into the ParsedArgumentsImpl's copy of
+        // command_line.
+        ArgumentIteratorImpl(std::string_view command_line,
+                             std::shared_ptr<const ParserData> data);
+
+        // Arguments from a source are only passed on to the caller,
+        // ParsedArgumentsImpl doesn't keep their values.
+        ArgumentIteratorImpl(std::unique_ptr<IArgumentSource> source,
+                             std::shared_ptr<const ParserData> data);
+
+        // The reset functions prepare a new parse like the corresponding
+        // constructors, but reuse the memory of the previous parse. The
+        // previous ParsedArgumentsImpl is only reused if nothing else
+        // refers to it.
+        void reset(const std::vector<std::string_view>& args,
+                   std::shared_ptr<const ParserData> data);
+
+        void reset(std::string_view command_line,
+                   std::shared_ptr<const ParserData> data);
 
         IteratorResult next();
 
+        // Processes all the arguments and returns the result.
+        std::shared_ptr<ParsedArgumentsImpl> parse_all();
+
         static std::shared_ptr<ParsedArgumentsImpl>
         parse(std::vector<std::string_view> args,
-              const std::shared_ptr<ParserData>& data);
+              const std::shared_ptr<const ParserData>& data);
+
+        static std::shared_ptr<ParsedArgumentsImpl>
+        parse(std::string_view command_line,
+              const std::shared_ptr<const ParserData>& data);
 
         [[nodiscard]] const std::shared_ptr<ParsedArgumentsImpl>&
         parsed_arguments() const;
+
+        // Returns the next batch of the arguments that were left when
+        // the parse ended. Only arguments from a source are left, the
+        // others are copied to the ParsedArgumentsImpl.
+        std::vector<std::string_view> remaining_arguments();
     private:
         enum class OptionResult
         {
@@ -54,25 +87,55 @@ namespace argos
         };
 
         std::pair<OptionResult, std::string_view>
-        process_option(const OptionData& opt, const std::string& flag);
+        process_option(const OptionData& opt, std::string_view flag);
 
-        IteratorResult process_option(const std::string& flag);
+        IteratorResult process_option(std::string_view flag);
 
-        IteratorResult process_argument(const std::string& name);
+        IteratorResult process_argument(const ArgumentData* argument,
+                                        std::string_view name);
+
+        bool process_subcommand(std::string_view name);
+
+        void reset_state(std::shared_ptr<const ParserData> data);
+
+        void initialize(std::vector<std::string_view>& args);
+
+        void initialize();
 
         void copy_remaining_arguments_to_parser_result();
 
-        [[nodiscard]] size_t count_arguments() const;
+        bool assign_deferred_arguments();
+
+        IteratorResult report_deferred_results(IteratorResult result);
+
+        IteratorResult next_deferred_result();
+
+        // Converts value and assigns it to the variable bound to the
+        // value of an argument or option. Calls error() and returns false
+        // if the conversion fails.
+        template <typename Data>
+        bool bind_value(IValueBinding& binding, const Data& data,
+                        std::string_view value, bool append,
+                        std::string_view name);
 
         bool check_argument_and_option_counts();
 
         void error(const std::string& message = {});
 
-        std::shared_ptr<ParserData> m_data;
-        std::vector<std::pair<std::string_view, const OptionData*>> m_options;
+        std::shared_ptr<const ParserData> m_data;
         std::shared_ptr<ParsedArgumentsImpl> m_parsed_args;
         std::unique_ptr<IOptionIterator> m_iterator;
+        // Holds the previous argument list between resets.
+        std::vector<std::string_view> m_args;
+        bool m_retain_arguments = true;
         ArgumentCounter m_argument_counter;
+        size_t m_argument_index = 0;
+        size_t m_fixed_count = SIZE_MAX;
+        size_t m_max_count = SIZE_MAX;
+        std::vector<std::string_view> m_deferred_arguments;
+        size_t m_deferred_index = 0;
+        ArgumentCounter m_deferred_counter;
+        std::optional<IteratorResult> m_final_result;
         enum class State
         {
             ARGUMENTS_AND_OPTIONS,
@@ -7,12 +7,22 @@
 //****************************************************************************
 #include "Argos/ArgumentParser.hpp"
 
-#include <algorithm>
+#include <atomic>
+#include <cstdlib>
 #include <cstring>
+#include <exception>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include "Argos/PrecompiledHelp.hpp"
 #include "ArgosThrow.hpp"
 #include "ArgumentIteratorImpl.hpp"
 #include "HelpText.hpp"
+#include "ParseValue.hpp"
 #include "ParserData.hpp"
 #include "StringUtilities.hpp"
 
@@ -66,204 +76,235 @@ namespace argos
             auto result = std::make_unique<ParserData>();
             result->parser_settings = data.parser_settings;
             result->help_settings = data.help_settings;
+            result->generation = data.generation;
             result->arguments.reserve(data.arguments.size());
             for (const auto& a : data.arguments)
                 result->arguments.push_back(std::make_unique<ArgumentData>(*a));
             result->options.reserve(data.options.size());
             for (const auto& o : data.options)
                 result->options.push_back(std::make_unique<OptionData>(*o));
+            result->subcommands.reserve(data.subcommands.size());
+            for (const auto& c : data.subcommands)
+                result->subcommands.push_back(std::make_unique<SubcommandData>(*c));
             return result;
         }
 
-        void set_alue_ids(const ParserData& data)
+        struct HelpDumpSettings
         {
-            struct InternalIdMaker
-            {
-                std::map<std::string_view, ValueId> explicit_ids;
-                ValueId n = ValueId(0);
-
-                std::optional<ValueId> find_value_id(std::string_view name)
-                {
-                    auto it = explicit_ids.find(name);
-                    if (it == explicit_ids.end())
-                        return {};
-                    return it->second;
-                }
-
-                ValueId make_value_id(std::string_view name)
-                {
-                    if (auto id = find_value_id(name))
-                        return *id;
-                    n = ValueId(n + 1);
-                    explicit_ids.emplace(name, n);
-                    return n;
-                }
+            std::string path;
+            std::vector<unsigned> line_widths;
+        };
+
+        // Set by enable_help_text_dump(), which is only called in the
+        // dump targets of argos_precompile_help().
+        std::atomic<bool> is_help_text_dump_enabled = false;
+
+        // The help texts are written to a header instead of parsing the
+        // arguments when the program runs with ARGOS_DUMP_HELP set to the
+        // header's path. See cmake/ArgosPrecompiledHelp.cmake.
+        std::optional<HelpDumpSettings> get_help_dump_settings()
+        {
+            const char* path = std::getenv("ARGOS_DUMP_HELP");
+            if (!path || !*path)
+                return {};
 
-                ValueId make_value_id(const std::vector<std::string>& names)
+            HelpDumpSettings settings{path, {}};
+            if (const char* widths = std::getenv("ARGOS_DUMP_HELP_WIDTHS"))
+            {
+                for (auto str : split_string(widths, ',', SIZE_MAX))
                 {
-                    for (const auto& name : names)
+                    auto width = parse_integer<unsigned>(str, 10);
+                    if (!width || *width <= 2)
                     {
-                        if (auto id = find_value_id(name))
-                            return *id;
+                        ARGOS_THROW("Invalid line width in"
+                                    " ARGOS_DUMP_HELP_WIDTHS: "
+                                    + std::string(str));
                     }
-                    n = ValueId(n + 1);
-                    for (const auto& name : names)
-                        explicit_ids.emplace(name, n);
-                    return n;
-                }
-            };
-
-            InternalIdMaker id_maker;
-            for (const auto& a : data.arguments)
-            {
-                if (!a->value.empty())
-                {
-                    a->value_id = id_maker.make_value_id(a->value);
-                    id_maker.explicit_ids.emplace(a->name, a->value_id);
-                }
-                else
-                {
-                    a->value_id = id_maker.make_value_id(a->name);
+                    settings.line_widths.push_back(*width);
                 }
             }
-            for (const auto& o : data.options)
-            {
-                if (o->operation == OptionOperation::NONE)
-                    continue;
-                if (!o->alias.empty())
-                {
-                    o->value_id = id_maker.make_value_id(o->alias);
-                    for (auto& f : o->flags)
-                        id_maker.explicit_ids.emplace(f, o->value_id);
-                }
-                else
-                {
-                    o->value_id = id_maker.make_value_id(o->flags);
-                }
-            }
-        }
-
-        inline bool has_help_option(const ParserData& data)
-        {
-            return std::any_of(data.options.begin(), data.options.end(),
-                               [](const auto& o)
-                               {return o->type == OptionType::HELP;});
+            if (settings.line_widths.empty())
+                settings.line_widths.push_back(80);
+            return settings;
         }
 
-        inline bool has_flag(const ParserData& data, std::string_view flag)
+        void collect_parser_data(std::shared_ptr<const ParserData> data,
+                                 std::vector<std::shared_ptr<const ParserData>>& result)
         {
-            bool ci = data.parser_settings.case_insensitive;
-            return any_of(data.options.begin(), data.options.end(),
-                          [&](const auto& o)
-                          {return any_of(o->flags.begin(), o->flags.end(),
-                                         [&](const auto& f)
-                                         {return are_equal(f, flag, ci);});
-                          });
+            result.push_back(data);
+            for (size_t i = 0; i < data->subcommands.size(); ++i)
+                collect_parser_data(get_subcommand_data(*data, i), result);
         }
 
-        void add_missing_help_option(ParserData& data)
+        void dump_help_texts_if_requested(
+            const std::shared_ptr<const ParserData>& data)
         {
-            if (!data.parser_settings.generate_help_option)
-                return;
-            if (has_help_option(data))
+            if (!is_help_text_dump_enabled)
                 return;
-            std::vector<std::string> flags;
-            switch (data.parser_settings.option_style)
-            {
-            case OptionStyle::STANDARD:
-                if (!has_flag(data, "-h"))
-                    flags.emplace_back("-h");
-                if (!has_flag(data, "--help"))
-                    flags.emplace_back("--help");
-                break;
-            case OptionStyle::SLASH:
-                if (!has_flag(data, "/?"))
-                    flags.emplace_back("/?");
-                break;
-            case OptionStyle::DASH:
-                if (!has_flag(data, "-h"))
-                    flags.emplace_back("-h");
-                else if (!has_flag(data, "-help"))
-                    flags.emplace_back("-help");
-                break;
-            }
-
-            if (flags.empty())
+            static const auto settings = get_help_dump_settings();
+            // Subcommands' parsers are finalized while the texts are dumped.
+            static std::atomic<bool> is_dumping = false;
+            if (!settings || is_dumping.exchange(true))
                 return;
 
-            auto opt = Option().flags(std::move(flags)).type(OptionType::HELP)
-                .help("Display the help text.")
-                .constant("1").release();
-            opt->argument_id = ArgumentId(data.options.size()
-                                          + data.arguments.size() + 1);
-            opt->section = data.current_section;
-            data.options.push_back(std::move(opt));
-        }
+            std::vector<std::shared_ptr<const ParserData>> parsers;
+            collect_parser_data(data, parsers);
+            std::vector<const ParserData*> ptrs;
+            for (const auto& p : parsers)
+                ptrs.push_back(p.get());
 
-        void add_version_option(ParserData& data)
-        {
-            if (data.help_settings.version.empty())
-                return;
-            std::string flag;
-            switch (data.parser_settings.option_style)
+            std::ofstream stream(settings->path);
+            if (stream)
+                write_precompiled_help_header(ptrs, settings->line_widths, stream);
+            if (!stream)
             {
-            case OptionStyle::STANDARD:
-                if (!has_flag(data, "--version"))
-                    flag = "--version";
-                break;
-            case OptionStyle::SLASH:
-                if (!has_flag(data, "/VERSION"))
-                    flag = "/VERSION";
-                break;
-            case OptionStyle::DASH:
-                if (!has_flag(data, "-version"))
-                    flag = "-version";
-                break;
+                std::cerr << "Argos: unable to write the help texts to "
+                          << settings->path << "\n";
+                exit(EXIT_FAILURE);
             }
+            stream.close();
+            exit(EXIT_SUCCESS);
+        }
 
-            if (flag.empty())
-                return;
-
-            auto stream = data.help_settings.output_stream
-                        ? data.help_settings.output_stream
-                        : &std::cout;
-            auto opt = Option().flag(flag).type(OptionType::STOP)
-                .help("Display the program version.")
-                .constant("1")
-                .callback([v = data.help_settings.version, stream]
-                              (auto, auto, auto pa)
-                          {
-                              *stream << pa.program_name() << " " << v << "\n";
-                              return true;
-                          })
-                .release();
-            opt->argument_id = ArgumentId(data.options.size()
-                                          + data.arguments.size() + 1);
-            opt->section = data.current_section;
-            data.options.push_back(std::move(opt));
+        std::shared_ptr<const ParserData>
+        finalize(std::unique_ptr<ParserData> data)
+        {
+            finalize_parser_data(*data);
+            std::shared_ptr<const ParserData> result = std::move(data);
+            dump_help_texts_if_requested(result);
+            return result;
         }
 
         ParsedArguments parse_impl(std::vector<std::string_view> args,
-                                   const std::shared_ptr<ParserData>& data)
+                                   std::shared_ptr<const ParserData> data)
         {
-            add_missing_help_option(*data);
-            add_version_option(*data);
-            set_alue_ids(*data);
             return ParsedArguments(
-                ArgumentIteratorImpl::parse(std::move(args), data));
+                ArgumentIteratorImpl::parse(std::move(args), std::move(data)));
+        }
+
+        std::vector<ParsedArguments> parse_batch_impl(
+            const std::vector<std::vector<std::string_view>>& command_lines,
+            const std::shared_ptr<const ParserData>& data,
+            unsigned thread_count)
+        {
+            // Workers grab small chunks of items, which balances the load
+            // when some command lines are much longer than others.
+            constexpr size_t CHUNK_SIZE = 64;
+            const auto size = command_lines.size();
+            std::vector<std::shared_ptr<ParsedArgumentsImpl>> results(size);
+            std::atomic<size_t> next_index = 0;
+            std::exception_ptr exception;
+            std::mutex exception_mutex;
+
+            auto worker = [&]
+            {
+                try
+                {
+                    while (true)
+                    {
+                        auto begin = next_index.fetch_add(CHUNK_SIZE);
+                        if (begin >= size)
+                            break;
+                        auto end = std::min(begin + CHUNK_SIZE, size);
+                        for (auto i = begin; i < end; ++i)
+                        {
+                            results[i] = ArgumentIteratorImpl::parse(
+                                command_lines[i], data);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(exception_mutex);
+                    if (!exception)
+                        exception = std::current_exception();
+                    next_index = size;
+                }
+            };
+
+            if (thread_count == 0)
+                thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+            auto chunk_count = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+            thread_count = unsigned(std::min<size_t>(thread_count, chunk_count));
+
+            std::vector<std::thread> threads;
+            for (unsigned i = 1; i < thread_count; ++i)
+                threads.emplace_back(worker);
+            worker();
+            for (auto& thread : threads)
+                thread.join();
+
+            if (exception)
+                std::rethrow_exception(exception);
+
+            std::vector<ParsedArguments> result;
+            result.reserve(size);
+            for (auto& impl : results)
+                result.emplace_back(std::move(impl));
+            return result;
         }
 
         ArgumentIterator
         make_iterator_impl(std::vector<std::string_view> args,
-                           const std::shared_ptr<ParserData>& data)
+                           std::shared_ptr<const ParserData> data)
         {
-            add_missing_help_option(*data);
-            add_version_option(*data);
-            set_alue_ids(*data);
-            return {std::move(args), data};
+            return {std::move(args), std::move(data)};
         }
 
         const char DEFAULT_NAME[] = "UNINITIALIZED";
+
+        size_t make_generation()
+        {
+            static std::atomic<size_t> next_generation = 1;
+            return next_generation++;
+        }
+    }
+
+    // The finalized copies of the parser data that const member functions
+    // share, one with the parser's own settings and one with the
+    // settings used by parse_batch.
+    struct ParserDataCache
+    {
+        struct Entry
+        {
+            std::atomic<bool> is_ready = false;
+            std::shared_ptr<const ParserData> data;
+        };
+
+        template <typename MakeData>
+        std::shared_ptr<const ParserData> get(Entry& entry,
+                                              MakeData make_data)
+        {
+            if (!entry.is_ready.load(std::memory_order_acquire))
+            {
+                std::lock_guard lock(mutex);
+                if (!entry.is_ready.load(std::memory_order_relaxed))
+                {
+                    entry.data = make_data();
+                    entry.is_ready.store(true, std::memory_order_release);
+                }
+            }
+            return entry.data;
+        }
+
+        void clear()
+        {
+            for (auto* entry : {&parser, &batch})
+            {
+                entry->is_ready.store(false, std::memory_order_relaxed);
+                entry->data.reset();
+            }
+        }
+
+        std::mutex mutex;
+        Entry parser;
+        Entry batch;
+    };
+
+    bool enable_help_text_dump()
+    {
+        is_help_text_dump_enabled = true;
+        return true;
     }
 
     ArgumentParser::ArgumentParser()
@@ -272,15 +313,18 @@ namespace argos
 
     ArgumentParser::ArgumentParser(std::string_view program_name,
                                    bool extract_file_name)
-        : m_data(std::make_unique<ParserData>())
+        : m_data(std::make_unique<ParserData>()),
+          m_cache(std::make_unique<ParserDataCache>())
     {
+        m_data->generation = make_generation();
         m_data->help_settings.program_name = extract_file_name
                                            ? get_base_name(program_name)
                                            : program_name;
     }
 
     ArgumentParser::ArgumentParser(ArgumentParser&& rhs) noexcept
-        : m_data(std::move(rhs.m_data))
+        : m_data(std::move(rhs.m_data)),
+          m_cache(std::move(rhs.m_cache))
     {}
 
     ArgumentParser::~ArgumentParser() = default;
@@ -288,6 +332,7 @@ namespace argos
     ArgumentParser& ArgumentParser::operator=(ArgumentParser&& rhs) noexcept
     {
         m_data = std::move(rhs.m_data);
+        m_cache = std::move(rhs.m_cache);
         return *this;
     }
 
@@ -297,6 +342,8 @@ namespace argos
         auto ad = argument.release();
         if (ad->name.empty())
             ARGOS_THROW("Argument must have a name.");
+        if (!m_data->subcommands.empty())
+            ARGOS_THROW("A parser with subcommands cannot have arguments.");
         ad->argument_id = next_argument_id();
         if (ad->section.empty())
             ad->section = m_data->current_section;
@@ -343,10 +390,15 @@ namespace argos
                 ARGOS_THROW("NONE-options cannot have a constant.");
             if (!od->alias.empty())
                 ARGOS_THROW("NONE-options cannot have an alias.");
+            if (od->binding)
+                ARGOS_THROW("NONE-options cannot be bound to a variable.");
             break;
         case OptionOperation::ASSIGN:
             if (od->argument.empty() && od->constant.empty())
+            {
                 od->constant = "1";
+                od->typed_constant = true;
+            }
             break;
         case OptionOperation::APPEND:
             if (od->argument.empty() && od->constant.empty())
@@ -358,6 +410,23 @@ namespace argos
             if (!od->optional)
                 ARGOS_THROW("CLEAR-options must be optional.");
             break;
+        case OptionOperation::COUNT:
+            if (!od->argument.empty())
+                ARGOS_THROW("COUNT-options cannot have an argument.");
+            if (!od->constant.empty())
+            {
+                auto step = parse_integer<long long>(od->constant, 10);
+                if (!step)
+                    ARGOS_THROW("COUNT-options must have an integer constant.");
+                od->count_step = *step;
+            }
+            break;
+        }
+        if (od->operation != OptionOperation::COUNT
+            && (od->min_count != std::numeric_limits<long long>::min()
+                || od->max_count != std::numeric_limits<long long>::max()))
+        {
+            ARGOS_THROW("Only COUNT-options can have limits.");
         }
         od->argument_id = next_argument_id();
         if (od->section.empty())
@@ -366,6 +435,22 @@ namespace argos
         return *this;
     }
 
+    ArgumentParser& ArgumentParser::add(Subcommand subcommand)
+    {
+        check_data();
+        auto sd = subcommand.release();
+        if (sd->name.empty())
+            ARGOS_THROW("Subcommand must have a name.");
+        if (!sd->factory)
+            ARGOS_THROW("Subcommand must have a factory.");
+        if (!m_data->arguments.empty())
+            ARGOS_THROW("A parser with arguments cannot have subcommands.");
+        if (sd->section.empty())
+            sd->section = m_data->current_section;
+        m_data->subcommands.push_back(std::move(sd));
+        return *this;
+    }
+
     ParsedArguments ArgumentParser::parse(int argc, char** argv)
     {
         if (argc <= 0)
@@ -389,14 +474,75 @@ namespace argos
 
     ParsedArguments ArgumentParser::parse(std::vector<std::string_view> args)
     {
-        check_data();
-        return parse_impl(std::move(args), std::move(m_data));
+        // The const check_data keeps the generation, handles from
+        // value_handle() are valid for the result.
+        std::as_const(*this).check_data();
+        return parse_impl(std::move(args), finalize(std::move(m_data)));
     }
 
     ParsedArguments ArgumentParser::parse(std::vector<std::string_view> args) const
+    {
+        return parse_impl(std::move(args), finalized_data());
+    }
+
+    ParsedArguments
+    ArgumentParser::parse(const std::vector<std::string_view>& args,
+                          ParseContext& context) const
+    {
+        auto& impl = context.m_impl;
+        if (impl)
+            impl->reset(args, finalized_data());
+        else
+            impl = std::make_unique<ArgumentIteratorImpl>(args, finalized_data());
+        return ParsedArguments(impl->parse_all());
+    }
+
+    ParsedArguments
+    ArgumentParser::parse_command_line(std::string_view command_line)
+    {
+        std::as_const(*this).check_data();
+        return ParsedArguments(ArgumentIteratorImpl::parse(
+            command_line, finalize(std::move(m_data))));
+    }
+
+    ParsedArguments
+    ArgumentParser::parse_command_line(std::string_view command_line) const
+    {
+        return ParsedArguments(ArgumentIteratorImpl::parse(
+            command_line, finalized_data()));
+    }
+
+    ParsedArguments
+    ArgumentParser::parse_command_line(std::string_view command_line,
+                                       ParseContext& context) const
+    {
+        auto& impl = context.m_impl;
+        if (impl)
+            impl->reset(command_line, finalized_data());
+        else
+            impl = std::make_unique<ArgumentIteratorImpl>(command_line,
+                                                          finalized_data());
+        return ParsedArguments(impl->parse_all());
+    }
+
+    std::vector<ParsedArguments> ArgumentParser::parse_batch(
+        const std::vector<std::vector<std::string_view>>& command_lines,
+        unsigned thread_count) const
     {
         check_data();
-        return parse_impl(std::move(args), make_copy(*m_data));
+        auto& cache = *m_cache;
+        auto data = cache.get(cache.batch, [&]
+        {
+            auto copy = make_copy(*m_data);
+            copy->parser_settings.auto_exit = false;
+            copy->parser_settings.write_error_messages = false;
+            copy->parser_settings.write_help_texts = false;
+            return finalize(std::move(copy));
+        });
+        // The workers would all write to the same variables.
+        if (!data->value_bindings.empty())
+            ARGOS_THROW("parse_batch can't be used with bound variables.");
+        return parse_batch_impl(command_lines, data, thread_count);
     }
 
     ArgumentIterator ArgumentParser::make_iterator(int argc, char** argv)
@@ -418,14 +564,32 @@ namespace argos
     {
         if (!m_data)
             ARGOS_THROW("This instance of ArgumentParser can no longer be used.");
-        return make_iterator_impl(std::move(args), std::move(m_data));
+        return make_iterator_impl(std::move(args), finalize(std::move(m_data)));
     }
 
     ArgumentIterator
     ArgumentParser::make_iterator(std::vector<std::string_view> args) const
+    {
+        return make_iterator_impl(std::move(args), finalized_data());
+    }
+
+    ArgumentIterator
+    ArgumentParser::make_iterator(std::unique_ptr<IArgumentSource> source)
+    {
+        std::as_const(*this).check_data();
+        m_data->parser_settings.borrow_arguments = false;
+        m_data->parser_settings.expand_response_files = false;
+        return {std::move(source), finalize(std::move(m_data))};
+    }
+
+    ArgumentIterator
+    ArgumentParser::make_iterator(std::unique_ptr<IArgumentSource> source) const
     {
         check_data();
-        return make_iterator_impl(std::move(args), make_copy(*m_data));
+        auto data = make_copy(*m_data);
+        data->parser_settings.borrow_arguments = false;
+        data->parser_settings.expand_response_files = false;
+        return {std::move(source), finalize(std::move(data))};
     }
 
     bool ArgumentParser::allow_abbreviated_options() const
@@ -454,6 +618,19 @@ namespace argos
         return *this;
     }
 
+    bool ArgumentParser::borrow_arguments() const
+    {
+        check_data();
+        return m_data->parser_settings.borrow_arguments;
+    }
+
+    ArgumentParser& ArgumentParser::borrow_arguments(bool value)
+    {
+        check_data();
+        m_data->parser_settings.borrow_arguments = value;
+        return *this;
+    }
+
     bool ArgumentParser::case_insensitive() const
     {
         check_data();
@@ -467,6 +644,19 @@ namespace argos
         return *this;
     }
 
+    bool ArgumentParser::expand_response_files() const
+    {
+        check_data();
+        return m_data->parser_settings.expand_response_files;
+    }
+
+    ArgumentParser& ArgumentParser::expand_response_files(bool value)
+    {
+        check_data();
+        m_data->parser_settings.expand_response_files = value;
+        return *this;
+    }
+
     bool ArgumentParser::generate_help_option() const
     {
         check_data();
@@ -590,10 +780,12 @@ namespace argos
     }
 
     ArgumentParser& ArgumentParser::text(TextId textId,
-                                         std::function<std::string()> callback)
+                                         std::function<std::string()> callback,
+                                         TextCallbackMode mode)
     {
         check_data();
-        m_data->help_settings.texts[textId] = std::move(callback);
+        m_data->help_settings.texts[textId] = make_text_source(
+            std::move(callback), mode);
         return *this;
     }
 
@@ -614,22 +806,35 @@ namespace argos
     ArgumentParser& ArgumentParser::line_width(unsigned int line_width)
     {
         check_data();
-        m_data->text_formatter.set_line_width(line_width);
+        if (line_width <= 2)
+            ARGOS_THROW("Line width must be greater than 2.");
+        m_data->help_settings.line_width = line_width;
         return *this;
     }
 
+    ValueHandle ArgumentParser::value_handle(const std::string& name) const
+    {
+        auto data = finalized_data();
+        return {get_value_id(*data, name), data->generation};
+    }
+
     void ArgumentParser::write_help_text() const
     {
-        check_data();
-        auto data = make_copy(*m_data);
-        add_missing_help_option(*data);
-        argos::write_help_text(*data);
+        argos::write_help_text(*finalized_data());
     }
 
     ArgumentParser& ArgumentParser::add_word_splitting_rule(std::string str)
     {
         check_data();
-        m_data->text_formatter.word_splitter().add_word(std::move(str));
+        // The rule is checked here, it isn't used until the help text
+        // is formatted.
+        for (auto pos = str.find(' '); pos != std::string::npos;
+             pos = str.find(' ', pos + 1))
+        {
+            if (pos == 0 || str[pos - 1] == ' ')
+                ARGOS_THROW("Invalid split rule: '" + str + "'");
+        }
+        m_data->help_settings.word_splitting_rules.push_back(std::move(str));
         return *this;
     }
 
@@ -652,6 +857,53 @@ namespace argos
             ARGOS_THROW("This instance of ArgumentParser can no longer be used.");
     }
 
+    void ArgumentParser::check_data()
+    {
+        // All non-const member functions end up here, and any of them can
+        // make the cached parser data and existing value handles obsolete.
+        std::as_const(*this).check_data();
+        m_cache->clear();
+        m_data->generation = make_generation();
+    }
+
+    std::shared_ptr<const ParserData> ArgumentParser::finalized_data() const
+    {
+        check_data();
+        auto& cache = *m_cache;
+        return cache.get(cache.parser,
+                         [&] {return finalize(make_copy(*m_data));});
+    }
+
+    std::shared_ptr<const ParserData>
+    get_finalized_data(const ArgumentParser& parser)
+    {
+        return parser.finalized_data();
+    }
+
+    std::shared_ptr<const ParserData>
+    get_subcommand_data(const ParserData& data, size_t index)
+    {
+        const auto& subcommand = *data.subcommands[index];
+        auto& cache = data.subcommand_data[index];
+        std::call_once(cache.flag, [&]
+        {
+            auto parser = subcommand.factory();
+            parser.check_data();
+            auto child = std::move(parser.m_data);
+            child->help_settings.program_name =
+                data.help_settings.program_name + " " + subcommand.name;
+            child->parser_settings.auto_exit = data.parser_settings.auto_exit;
+            child->parser_settings.write_error_messages =
+                data.parser_settings.write_error_messages;
+            child->parser_settings.write_help_texts =
+                data.parser_settings.write_help_texts;
+            if (data.help_settings.output_stream)
+                child->help_settings.output_stream = data.help_settings.output_stream;
+            cache.data = finalize(std::move(child));
+        });
+        return cache.data;
+    }
+
     ArgumentId ArgumentParser::next_argument_id() const
     {
         auto& d = *m_data;
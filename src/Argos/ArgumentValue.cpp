@@ -7,6 +7,7 @@
 //****************************************************************************
 #include "Argos/ArgumentValue.hpp"
 
+#include <limits>
 #include "Argos/ArgumentValues.hpp"
 #include "ArgosThrow.hpp"
 #include "ParseValue.hpp"
@@ -18,28 +19,110 @@ namespace argos
     namespace
     {
         template <typename T>
-        T get_integer(const ArgumentValue& value, T default_value, int base)
+        bool is_in_range(long long n)
+        {
+            using limits = std::numeric_limits<T>;
+            if constexpr (std::is_signed_v<T>)
+                return limits::min() <= n && n <= limits::max();
+            else
+                return n >= 0 && (unsigned long long)n <= limits::max();
+        }
+
+        // Identifies a value in ParsedArgumentsImpl, to check if it's
+        // a count or a typed constant that doesn't have to be parsed.
+        struct ValueSource
+        {
+            const ParsedArgumentsImpl* args;
+            ValueId value_id;
+            ArgumentId argument_id;
+        };
+
+        const TypedValue* find_typed_value(const ValueSource& source,
+                                           std::string_view value)
+        {
+            if (!source.args)
+                return nullptr;
+            return find_typed_value(*source.args->parser_data(),
+                                    source.argument_id, value);
+        }
+
+        // Returns the value as an integer if it was set by a COUNT-option
+        // or is a typed bool or integer constant.
+        std::optional<long long> find_integer(const ValueSource& source,
+                                              std::string_view value)
+        {
+            if (!source.args)
+                return {};
+            if (const auto* count = source.args->find_count(source.value_id))
+                return *count;
+            if (const auto* typed = find_typed_value(source, value))
+            {
+                if (const auto* b = std::get_if<bool>(typed))
+                    return *b ? 1 : 0;
+                if (const auto* n = std::get_if<long long>(typed))
+                    return *n;
+            }
+            return {};
+        }
+
+        template <typename T>
+        T get_integer(const ArgumentValue& value, const ValueSource& source,
+                      T default_value, int base)
         {
             auto s = value.value();
             if (!s)
                 return default_value;
-            auto n = parse_integer<T>(std::string(*s), base);
+            if (base == 10 || base == 0)
+            {
+                auto n = find_integer(source, *s);
+                if (n && is_in_range<T>(*n))
+                    return T(*n);
+            }
+            auto n = parse_integer<T>(*s, base);
             if (!n)
                 value.error();
             return *n;
         }
 
         template <typename T>
-        T get_floating_point(const ArgumentValue& value, T default_value)
+        T get_floating_point(const ArgumentValue& value,
+                             const ValueSource& source, T default_value)
         {
             auto s = value.value();
             if (!s)
                 return default_value;
-            auto n = parse_floating_point<T>(std::string(*s));
+            // Converting a double to float could round differently than
+            // parsing the string.
+            if constexpr (std::is_same_v<T, double>)
+            {
+                if (const auto* typed = find_typed_value(source, *s))
+                {
+                    if (const auto* d = std::get_if<double>(typed))
+                        return *d;
+                }
+            }
+            if (auto i = find_integer(source, *s))
+                return T(*i);
+            auto n = parse_floating_point<T>(*s);
             if (!n)
                 value.error();
             return *n;
         }
+
+        template <typename T, typename ParseFunc>
+        std::vector<T> split_and_parse(const ArgumentValue& value,
+                                       char separator,
+                                       const std::vector<T>& default_value,
+                                       ParseFunc parse)
+        {
+            auto s = value.value();
+            if (!s)
+                return default_value;
+            std::vector<T> result;
+            if (!parse_parts(*s, separator, parse, result))
+                value.error();
+            return result;
+        }
     }
 
     ArgumentValue::ArgumentValue()
@@ -91,49 +174,60 @@ namespace argos
     {
         if (!m_value)
             return default_value;
+        // Typed bools are stored as "1" and "0", comparing the string is
+        // cheaper than looking up the typed value.
         return !m_value->empty() && m_value != "0" && m_value != "false";
     }
 
     int ArgumentValue::as_int(int default_value, int base) const
     {
-        return get_integer<int>(*this, default_value, base);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_integer<int>(*this, source, default_value, base);
     }
 
     unsigned ArgumentValue::as_uint(unsigned default_value, int base) const
     {
-        return get_integer<unsigned>(*this, default_value, base);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_integer<unsigned>(*this, source, default_value, base);
     }
 
     long ArgumentValue::as_long(long default_value, int base) const
     {
-        return get_integer<long>(*this, default_value, base);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_integer<long>(*this, source, default_value, base);
     }
 
     long long ArgumentValue::as_llong(long long default_value, int base) const
     {
-        return get_integer<long long>(*this, default_value, base);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_integer<long long>(*this, source, default_value, base);
     }
 
     unsigned long
     ArgumentValue::as_ulong(unsigned long default_value, int base) const
     {
-        return get_integer<unsigned long>(*this, default_value, base);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_integer<unsigned long>(*this, source, default_value, base);
     }
 
     unsigned long long
     ArgumentValue::as_ullong(unsigned long long default_value, int base) const
     {
-        return get_integer<unsigned long long>(*this, default_value, base);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_integer<unsigned long long>(*this, source, default_value,
+                                               base);
     }
 
     float ArgumentValue::as_float(float default_value) const
     {
-        return get_floating_point<float>(*this, default_value);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_floating_point<float>(*this, source, default_value);
     }
 
     double ArgumentValue::as_double(double default_value) const
     {
-        return get_floating_point<double>(*this, default_value);
+        const ValueSource source{m_args.get(), m_value_id, m_argument_id};
+        return get_floating_point<double>(*this, source, default_value);
     }
 
     std::string ArgumentValue::as_string(const std::string& default_value) const
@@ -163,6 +257,38 @@ namespace argos
         return {std::move(values), m_args, m_value_id};
     }
 
+    std::vector<int>
+    ArgumentValue::split_as_ints(char separator,
+                                 const std::vector<int>& default_value,
+                                 int base) const
+    {
+        return split_and_parse(*this, separator, default_value,
+                               [&](std::string_view s)
+                               {
+                                   return parse_integer<int>(s, base);
+                               });
+    }
+
+    std::vector<long long>
+    ArgumentValue::split_as_llongs(char separator,
+                                   const std::vector<long long>& default_value,
+                                   int base) const
+    {
+        return split_and_parse(*this, separator, default_value,
+                               [&](std::string_view s)
+                               {
+                                   return parse_integer<long long>(s, base);
+                               });
+    }
+
+    std::vector<double>
+    ArgumentValue::split_as_doubles(
+        char separator, const std::vector<double>& default_value) const
+    {
+        return split_and_parse(*this, separator, default_value,
+                               parse_floating_point<double>);
+    }
+
     void ArgumentValue::error(const std::string& message) const
     {
         if (!m_args)
@@ -45,7 +45,7 @@ namespace argos
             result.reserve(values.size());
             for (auto& v : values.raw_values())
             {
-                auto value = parse_floating_point<T>(std::string(v));
+                auto value = parse_floating_point<T>(v);
                 if (!value)
                     error(values, v);
                 else
@@ -54,6 +54,27 @@ namespace argos
             return result;
         }
 
+        template <typename T, typename ParseFunc>
+        std::vector<T> split_and_parse(
+            const ArgumentValues& values,
+            const std::vector<std::pair<std::string_view, ArgumentId>>& raw_values,
+            char separator,
+            const std::vector<T>& default_value,
+            ParseFunc parse)
+        {
+            if (raw_values.empty())
+                return default_value;
+
+            std::vector<T> result;
+            result.reserve(raw_values.size());
+            for (auto& v : raw_values)
+            {
+                if (!parse_parts(v.first, separator, parse, result))
+                    error(values, v.first);
+            }
+            return result;
+        }
+
         template <typename T>
         std::vector<T> parse_integers(const ArgumentValues& values,
                                       const std::vector<T>& default_value,
@@ -66,7 +87,7 @@ namespace argos
             result.reserve(values.size());
             for (auto& v : values.raw_values())
             {
-                auto value = parse_integer<T>(std::string(v), base);
+                auto value = parse_integer<T>(v, base);
                 if (!value)
                     error(values, v);
                 else
@@ -242,6 +263,38 @@ namespace argos
         return {std::move(values), m_args, m_value_id};
     }
 
+    std::vector<int>
+    ArgumentValues::split_as_ints(char separator,
+                                  const std::vector<int>& default_value,
+                                  int base) const
+    {
+        return split_and_parse(*this, m_values, separator, default_value,
+                               [&](std::string_view s)
+                               {
+                                   return parse_integer<int>(s, base);
+                               });
+    }
+
+    std::vector<long long>
+    ArgumentValues::split_as_llongs(
+        char separator, const std::vector<long long>& default_value,
+        int base) const
+    {
+        return split_and_parse(*this, m_values, separator, default_value,
+                               [&](std::string_view s)
+                               {
+                                   return parse_integer<long long>(s, base);
+                               });
+    }
+
+    std::vector<double>
+    ArgumentValues::split_as_doubles(
+        char separator, const std::vector<double>& default_value) const
+    {
+        return split_and_parse(*this, m_values, separator, default_value,
+                               parse_floating_point<double>);
+    }
+
     ArgumentValueIterator ArgumentValues::begin() const
     {
         return ArgumentValueIterator(m_values.begin(), m_args, m_value_id);
@@ -0,0 +1,141 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "CommandLineTokenizer.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace argos
+{
+    namespace
+    {
+        enum CharClass : uint8_t
+        {
+            OTHER,
+            SPACE,
+            QUOTE_OR_ESCAPE
+        };
+
+        constexpr auto CHAR_CLASSES = []
+        {
+            std::array<CharClass, 256> classes = {};
+            for (auto c : {' ', '\t', '\n', '\v', '\f', '\r'})
+                classes[uint8_t(c)] = SPACE;
+            for (auto c : {'"', '\'', '\\'})
+                classes[uint8_t(c)] = QUOTE_OR_ESCAPE;
+            return classes;
+        }();
+
+        CharClass get_char_class(char c)
+        {
+            return CHAR_CLASSES[uint8_t(c)];
+        }
+
+        bool is_space(char c)
+        {
+            return get_char_class(c) == SPACE;
+        }
+
+        // The characters a backslash escapes inside double quotes,
+        // newline aside.
+        bool is_escapable_in_double_quotes(char c)
+        {
+            return c == '$' || c == '`' || c == '"' || c == '\\';
+        }
+    }
+
+    size_t max_token_count(std::string_view text)
+    {
+        size_t count = 1;
+        for (auto c : text)
+            count += is_space(c) ? 1 : 0;
+        return count;
+    }
+
+    void tokenize_command_line(char* text, size_t size,
+                               std::vector<std::string_view>& tokens)
+    {
+        char* const end = text + size;
+        char* it = text;
+        while (true)
+        {
+            while (it != end && is_space(*it))
+                ++it;
+            if (it == end)
+                break;
+
+            // Most tokens have neither quotes nor escapes.
+            char* token = it;
+            while (it != end && get_char_class(*it) == OTHER)
+                ++it;
+            if (it == end || is_space(*it))
+            {
+                tokens.emplace_back(token, size_t(it - token));
+                continue;
+            }
+
+            // Tokens with quotes or escapes are compacted where they start.
+            // Characters are only written after a quote or escape has been
+            // removed, other tokens leave the text untouched.
+            char* out = it;
+            auto put = [&out](const char* c)
+            {
+                if (out != c)
+                    *out = *c;
+                ++out;
+            };
+
+            char quote = 0;
+            bool is_quoted = false;
+            for (; it != end; ++it)
+            {
+                const char c = *it;
+                if (quote == '\'')
+                {
+                    if (c == '\'')
+                        quote = 0;
+                    else
+                        put(it);
+                }
+                else if (c == '\\' && it + 1 != end)
+                {
+                    if (it[1] == '\n')
+                        ++it;
+                    else if (quote != '"' || is_escapable_in_double_quotes(it[1]))
+                        put(++it);
+                    else
+                        put(it);
+                }
+                else if (quote == '"')
+                {
+                    if (c == '"')
+                        quote = 0;
+                    else
+                        put(it);
+                }
+                else if (c == '"' || c == '\'')
+                {
+                    quote = c;
+                    is_quoted = true;
+                }
+                else if (is_space(c))
+                {
+                    break;
+                }
+                else
+                {
+                    put(it);
+                }
+            }
+            // A token that only consisted of line continuations is
+            // not an argument, while empty quotes are.
+            if (out != token || is_quoted)
+                tokens.emplace_back(token, size_t(out - token));
+        }
+    }
+}
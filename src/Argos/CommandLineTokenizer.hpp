@@ -0,0 +1,30 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <string_view>
+#include <vector>
+
+namespace argos
+{
+    // Returns an upper bound for the number of tokens
+    // tokenize_command_line() finds in text. Every token except the first
+    // is preceded by white space, which makes the bound cheap to compute.
+    size_t max_token_count(std::string_view text);
+
+    // Splits text into arguments separated by white space and appends them
+    // to tokens, following the quoting rules of the POSIX shell. Single
+    // and double quotes group characters. Outside quotes, backslash
+    // escapes the following character. Inside double quotes it only
+    // escapes $, `, " and \, and is otherwise kept. Backslash followed by
+    // a newline is a line continuation and is removed everywhere except
+    // inside single quotes. An unterminated quote extends to the end of
+    // text. Quotes and escapes are removed by modifying text, the tokens
+    // are views into it.
+    void tokenize_command_line(char* text, size_t size,
+                               std::vector<std::string_view>& tokens);
+}
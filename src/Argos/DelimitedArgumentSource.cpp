@@ -0,0 +1,114 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Argos/DelimitedArgumentSource.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include "ArgosThrow.hpp"
+
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <unistd.h>
+#endif
+
+namespace argos
+{
+    namespace
+    {
+        ptrdiff_t read_fd(int fd, char* buffer, size_t size)
+        {
+#if defined(_WIN32)
+            return _read(fd, buffer, unsigned(std::min<size_t>(size, INT_MAX)));
+#else
+            return read(fd, buffer, size);
+#endif
+        }
+    }
+
+    DelimitedArgumentSource::DelimitedArgumentSource(int fd, char delimiter,
+                                                     size_t chunk_size)
+        : m_fd(fd),
+          m_delimiter(delimiter),
+          m_chunk_size(std::max<size_t>(chunk_size, 1))
+    {}
+
+    bool DelimitedArgumentSource::next_batch(std::vector<std::string_view>& args)
+    {
+        args.clear();
+        if (m_end_of_file && m_partial_argument.empty())
+            return false;
+
+        // The previous batch remains valid, the new batch goes into the
+        // buffer that held the batch before that. The incomplete argument
+        // at the end of the previous batch is moved to the front.
+        m_buffer_index ^= 1;
+        auto& buffer = m_buffers[m_buffer_index];
+        auto partial_size = m_partial_argument.size();
+        if (buffer.size() < std::max(m_chunk_size, 2 * partial_size))
+            buffer.resize(std::max(m_chunk_size, 2 * partial_size));
+        std::copy(m_partial_argument.begin(), m_partial_argument.end(),
+                  buffer.begin());
+
+        // Read until the buffer contains at least one complete argument.
+        auto size = partial_size;
+        auto end = size_t(0);
+        while (true)
+        {
+            auto prev_size = size;
+            size = read_chunk(buffer, size);
+            if (size == prev_size)
+            {
+                m_end_of_file = true;
+                end = size;
+                break;
+            }
+            auto it = std::find(buffer.rbegin() + ptrdiff_t(buffer.size() - size),
+                                buffer.rend() - ptrdiff_t(prev_size),
+                                m_delimiter);
+            if (it != buffer.rend() - ptrdiff_t(prev_size))
+            {
+                end = size_t(buffer.rend() - it);
+                break;
+            }
+            if (size == buffer.size())
+                buffer.resize(buffer.size() * 2);
+        }
+
+        const auto* data = buffer.data();
+        size_t start = 0;
+        while (start < end)
+        {
+            auto pos = std::find(data + start, data + end, m_delimiter);
+            args.emplace_back(data + start, size_t(pos - data - start));
+            start = size_t(pos - data) + 1;
+        }
+        if (m_end_of_file)
+            m_partial_argument = {};
+        else
+            m_partial_argument = std::string_view(data + end, size - end);
+        return !args.empty() || !m_partial_argument.empty();
+    }
+
+    size_t DelimitedArgumentSource::read_chunk(std::string& buffer,
+                                               size_t offset)
+    {
+        while (true)
+        {
+            auto n = read_fd(m_fd, buffer.data() + offset,
+                             buffer.size() - offset);
+            if (n >= 0)
+                return offset + size_t(n);
+            if (errno != EINTR)
+                ARGOS_THROW("Error while reading arguments: "
+                            + std::string(strerror(errno)));
+        }
+    }
+}
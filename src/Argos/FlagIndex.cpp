@@ -0,0 +1,264 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "FlagIndex.hpp"
+
+#include <algorithm>
+#include "StringUtilities.hpp"
+
+namespace argos
+{
+    namespace
+    {
+        constexpr uint32_t MAX_SEED_ATTEMPTS = 1u << 16;
+
+        uint64_t mix(uint64_t x)
+        {
+            x ^= x >> 30;
+            x *= 0xBF58476D1CE4E5B9ull;
+            x ^= x >> 27;
+            x *= 0x94D049BB133111EBull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        size_t get_bucket(uint64_t hash, size_t bucket_count)
+        {
+            return size_t(mix(hash) % bucket_count);
+        }
+
+        size_t get_slot(uint64_t hash, uint32_t seed, size_t slot_count)
+        {
+            return size_t(mix(hash + seed * 0x9E3779B97F4A7C15ull)
+                          % slot_count);
+        }
+    }
+
+    FlagIndex::FlagIndex(
+            const std::vector<std::pair<std::string_view, const OptionData*>>& flags,
+            bool case_insensitive)
+        : m_case_insensitive(case_insensitive)
+    {
+        if (flags.empty())
+            return;
+
+        std::vector<Slot> keys;
+        keys.reserve(flags.size());
+        for (const auto& [flag, option] : flags)
+        {
+            Slot slot{std::string(flag), option};
+            for (auto& c : slot.key)
+                c = fold(c);
+            keys.push_back(std::move(slot));
+        }
+
+        while (!build_hash_table(keys))
+            ++m_hash_seed;
+
+        // The trie is built over the slots, sorted by key.
+        std::vector<uint32_t> slots;
+        for (uint32_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i].option)
+                slots.push_back(i);
+        }
+        std::sort(slots.begin(), slots.end(), [&](auto a, auto b)
+        {
+            return m_slots[a].key < m_slots[b].key;
+        });
+        build_trie(slots, 0, slots.size(), 0);
+    }
+
+    const OptionData* FlagIndex::find(std::string_view flag) const
+    {
+        if (m_slots.empty())
+            return nullptr;
+        auto h = hash(flag);
+        auto seed = m_seeds[get_bucket(h, m_seeds.size())];
+        const auto& slot = m_slots[get_slot(h, seed, m_slots.size())];
+        if (slot.option && matches(slot, flag))
+            return slot.option;
+        return nullptr;
+    }
+
+    const OptionData* FlagIndex::find_abbreviated(std::string_view flag) const
+    {
+        if (m_nodes.empty())
+            return nullptr;
+
+        const Node* node = &m_nodes[0];
+        size_t pos = 0;
+        while (true)
+        {
+            const auto& key = m_slots[node->slot].key;
+            auto end = std::min<size_t>(node->prefix_size, flag.size());
+            for (; pos < end; ++pos)
+            {
+                if (fold(flag[pos]) != key[pos])
+                    return nullptr;
+            }
+
+            if (pos == flag.size())
+                return node->option;
+
+            auto c = fold(flag[pos++]);
+            auto first = m_edges.begin() + node->first_edge;
+            auto last = first + node->edge_count;
+            auto it = std::lower_bound(
+                first, last, c,
+                [](auto& e, char ch) {return uint8_t(e.first) < uint8_t(ch);});
+            if (it == last || it->first != c)
+                return nullptr;
+            node = &m_nodes[it->second];
+        }
+    }
+
+    uint64_t FlagIndex::hash(std::string_view str) const
+    {
+        uint64_t h = 14695981039346656037ull ^ m_hash_seed;
+        for (char c : str)
+        {
+            h ^= uint8_t(fold(c));
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    char FlagIndex::fold(char c) const
+    {
+        if (m_case_insensitive && 'A' <= c && c <= 'Z')
+            return char(c + ('a' - 'A'));
+        return c;
+    }
+
+    bool FlagIndex::matches(const Slot& slot, std::string_view flag) const
+    {
+        return are_equal(slot.key, flag, m_case_insensitive);
+    }
+
+    bool FlagIndex::build_hash_table(const std::vector<Slot>& keys)
+    {
+        // Hash and displace: the keys are distributed among buckets, and
+        // each bucket gets a seed that places all its keys in empty slots.
+        auto bucket_count = (keys.size() + 3) / 4;
+        auto slot_count = keys.size() + keys.size() / 4 + 1;
+        std::vector<std::vector<size_t>> buckets(bucket_count);
+        std::vector<uint64_t> hashes;
+        for (size_t i = 0; i < keys.size(); ++i)
+        {
+            hashes.push_back(hash(keys[i].key));
+            buckets[get_bucket(hashes.back(), bucket_count)].push_back(i);
+        }
+
+        std::vector<size_t> order(bucket_count);
+        for (size_t i = 0; i < bucket_count; ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](auto a, auto b)
+        {
+            return buckets[a].size() > buckets[b].size();
+        });
+
+        m_slots.assign(slot_count, {});
+        m_seeds.assign(bucket_count, 0);
+        std::vector<size_t> taken;
+        for (auto b : order)
+        {
+            const auto& bucket = buckets[b];
+            if (bucket.empty())
+                break;
+
+            uint32_t seed = 0;
+            for (; seed < MAX_SEED_ATTEMPTS; ++seed)
+            {
+                taken.clear();
+                for (auto k : bucket)
+                {
+                    auto s = get_slot(hashes[k], seed, slot_count);
+                    if (m_slots[s].option
+                        || std::find(taken.begin(), taken.end(), s)
+                           != taken.end())
+                    {
+                        break;
+                    }
+                    taken.push_back(s);
+                }
+                if (taken.size() == bucket.size())
+                    break;
+            }
+
+            // Keys with identical hashes can't be separated, start over
+            // with a different hash seed.
+            if (seed == MAX_SEED_ATTEMPTS)
+                return false;
+
+            m_seeds[b] = seed;
+            for (size_t i = 0; i < bucket.size(); ++i)
+                m_slots[taken[i]] = keys[bucket[i]];
+        }
+        return true;
+    }
+
+    uint32_t FlagIndex::build_trie(const std::vector<uint32_t>& slots,
+                                   size_t begin, size_t end, size_t depth)
+    {
+        auto key = [&](size_t i) -> const std::string&
+        {
+            return m_slots[slots[i]].key;
+        };
+
+        auto index = uint32_t(m_nodes.size());
+        m_nodes.emplace_back();
+        m_nodes[index].slot = slots[begin];
+        if (end - begin == 1)
+        {
+            m_nodes[index].prefix_size = uint32_t(key(begin).size());
+            m_nodes[index].option = m_slots[slots[begin]].option;
+            return index;
+        }
+
+        // The keys are sorted, the common prefix of the first and last
+        // key is shared by all keys in between.
+        const auto& first_key = key(begin);
+        const auto& last_key = key(end - 1);
+        auto prefix_size = depth;
+        while (prefix_size < first_key.size()
+               && first_key[prefix_size] == last_key[prefix_size])
+        {
+            ++prefix_size;
+        }
+        m_nodes[index].prefix_size = uint32_t(prefix_size);
+
+        // A key that ends at this node sorts before the longer ones.
+        auto i = begin;
+        if (key(i).size() == prefix_size)
+            ++i;
+
+        std::vector<std::pair<char, std::pair<size_t, size_t>>> groups;
+        while (i != end)
+        {
+            auto c = key(i)[prefix_size];
+            auto j = i + 1;
+            while (j != end && key(j)[prefix_size] == c)
+                ++j;
+            groups.push_back({c, {i, j}});
+            i = j;
+        }
+
+        auto first_edge = uint32_t(m_edges.size());
+        m_nodes[index].first_edge = first_edge;
+        m_nodes[index].edge_count = uint32_t(groups.size());
+        m_edges.resize(m_edges.size() + groups.size());
+        for (size_t g = 0; g < groups.size(); ++g)
+        {
+            auto [c, range] = groups[g];
+            auto child = build_trie(slots, range.first, range.second,
+                                    prefix_size + 1);
+            m_edges[first_edge + g] = {c, child};
+        }
+        return index;
+    }
+}
@@ -0,0 +1,71 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace argos
+{
+    struct OptionData;
+
+    class FlagIndex
+    {
+    public:
+        FlagIndex() = default;
+
+        FlagIndex(
+            const std::vector<std::pair<std::string_view, const OptionData*>>& flags,
+            bool case_insensitive);
+
+        [[nodiscard]] const OptionData* find(std::string_view flag) const;
+
+        [[nodiscard]]
+        const OptionData* find_abbreviated(std::string_view flag) const;
+    private:
+        struct Slot
+        {
+            std::string key;
+            const OptionData* option = nullptr;
+        };
+
+        // A node in a radix trie. The characters of the node's prefix
+        // that follow the edge leading to it are read from the key in
+        // slot. Nodes for the prefix of exactly one flag are leaves,
+        // and they are the only nodes that have an option.
+        struct Node
+        {
+            uint32_t first_edge = 0;
+            uint32_t edge_count = 0;
+            uint32_t slot = 0;
+            uint32_t prefix_size = 0;
+            const OptionData* option = nullptr;
+        };
+
+        [[nodiscard]] uint64_t hash(std::string_view str) const;
+
+        [[nodiscard]] char fold(char c) const;
+
+        [[nodiscard]] bool matches(const Slot& slot,
+                                   std::string_view flag) const;
+
+        bool build_hash_table(const std::vector<Slot>& keys);
+
+        uint32_t build_trie(const std::vector<uint32_t>& slots,
+                            size_t begin, size_t end, size_t depth);
+
+        std::vector<Slot> m_slots;
+        std::vector<uint32_t> m_seeds;
+        std::vector<Node> m_nodes;
+        std::vector<std::pair<char, uint32_t>> m_edges;
+        uint64_t m_hash_seed = 0;
+        bool m_case_insensitive = false;
+    };
+}
@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <iostream>
+#include <sstream>
+#include "TextFormatter.hpp"
 
 namespace argos
 {
@@ -116,7 +118,7 @@ namespace argos
         }
 
         std::optional<std::string>
-        get_custom_text(ParserData& data, TextId text_id)
+        get_custom_text(const ParserData& data, TextId text_id)
         {
             auto it = data.help_settings.texts.find(text_id);
             if (it != data.help_settings.texts.end())
@@ -133,22 +135,23 @@ namespace argos
         }
 
         std::optional<std::string>
-        write_custom_text(ParserData& data, TextId text_id,
-                          bool prepend_newline = false)
+        write_custom_text(const ParserData& data, TextFormatter& formatter,
+                          TextId text_id, bool prepend_newline = false)
         {
             auto text = get_custom_text(data, text_id);
             if (!is_empty(text))
             {
                 if (prepend_newline)
-                    data.text_formatter.newline();
-                data.text_formatter.write_words(*text);
-                if (!data.text_formatter.is_current_line_empty())
-                    data.text_formatter.newline();
+                    formatter.newline();
+                formatter.write_words(*text);
+                if (!formatter.is_current_line_empty())
+                    formatter.newline();
             }
             return text;
         }
 
-        void write_stop_and_help_usage(ParserData& data)
+        void write_stop_and_help_usage(const ParserData& data,
+                                       TextFormatter& formatter)
         {
             for (auto& opt : data.options)
             {
@@ -158,13 +161,13 @@ namespace argos
                     continue;
                 }
 
-                data.text_formatter.write_words(data.help_settings.program_name);
-                data.text_formatter.write_words(" ");
-                data.text_formatter.push_indentation(TextFormatter::CURRENT_COLUMN);
-                data.text_formatter.write_lines(get_brief_option_name(*opt, true));
-                data.text_formatter.write_words(" ");
-                data.text_formatter.pop_indentation();
-                data.text_formatter.newline();
+                formatter.write_words(data.help_settings.program_name);
+                formatter.write_words(" ");
+                formatter.push_indentation(TextFormatter::CURRENT_COLUMN);
+                formatter.write_lines(get_brief_option_name(*opt, true));
+                formatter.write_words(" ");
+                formatter.pop_indentation();
+                formatter.newline();
             }
         }
 
@@ -173,7 +176,7 @@ namespace argos
         using SectionHelpTexts = std::pair<std::string_view, HelpTextVector>;
 
         unsigned int get_help_text_label_width(
-            const ParserData& data,
+            const TextFormatter& formatter,
             const std::vector<SectionHelpTexts>& sections)
         {
             // Determine what width should be reserved for the argument names
@@ -191,7 +194,7 @@ namespace argos
 
             std::sort(name_widths.begin(), name_widths.end());
             std::sort(text_widths.begin(), text_widths.end());
-            auto line_width = data.text_formatter.line_width();
+            auto line_width = formatter.line_width();
             // Check if both the longest name and the longest help text
             // can fit on the same line.
             auto name_width = name_widths.back() + 3;
@@ -200,7 +203,9 @@ namespace argos
             return name_width;
         }
 
-        void write_argument_sections(ParserData& data, bool prepend_newline)
+        void write_argument_sections(const ParserData& data,
+                                     TextFormatter& formatter,
+                                     bool prepend_newline)
         {
             std::vector<SectionHelpTexts> sections;
 
@@ -227,6 +232,16 @@ namespace argos
                 auto& section = a->section.empty() ? *arg_title : a->section;
                 add_help_text(section, get_argument_name(*a), get_text(a->help));
             }
+            auto cmd_title = get_custom_text(data, TextId::COMMANDS_TITLE);
+            if (!cmd_title)
+                cmd_title = "COMMANDS";
+            for (auto& c : data.subcommands)
+            {
+                if ((c->visibility & Visibility::TEXT) == Visibility::HIDDEN)
+                    continue;
+                auto& section = c->section.empty() ? *cmd_title : c->section;
+                add_help_text(section, c->name, get_text(c->help));
+            }
             auto opt_title = get_custom_text(data, TextId::OPTIONS_TITLE);
             if (!opt_title)
                 opt_title = "OPTIONS";
@@ -240,9 +255,8 @@ namespace argos
 
             if (sections.empty())
                 return;
-            unsigned int name_width = get_help_text_label_width(data, sections);
+            unsigned int name_width = get_help_text_label_width(formatter, sections);
 
-            auto& formatter = data.text_formatter;
             for (auto&[section, txts] : sections)
             {
                 if (prepend_newline)
@@ -276,14 +290,15 @@ namespace argos
             }
         }
 
-        void write_brief_usage(ParserData& data, bool prepend_newline)
+        void write_brief_usage(const ParserData& data,
+                               TextFormatter& formatter,
+                               bool prepend_newline)
         {
-            auto& formatter = data.text_formatter;
             if (prepend_newline)
                 formatter.newline();
 
             formatter.push_indentation(2);
-            write_stop_and_help_usage(data);
+            write_stop_and_help_usage(data, formatter);
             formatter.write_words(data.help_settings.program_name);
             formatter.write_words(" ");
             formatter.push_indentation(TextFormatter::CURRENT_COLUMN);
@@ -305,89 +320,244 @@ namespace argos
                 formatter.write_lines(get_argument_name(*arg));
                 formatter.write_words(" ");
             }
+            if (!data.subcommands.empty())
+            {
+                formatter.write_lines("<command>");
+                formatter.write_words(" ");
+                formatter.write_lines("[<arguments>]...");
+                formatter.write_words(" ");
+            }
             formatter.pop_indentation();
             formatter.newline();
             formatter.pop_indentation();
         }
 
-        bool write_usage(ParserData& data, bool prepend_newline = false)
+        bool write_usage(const ParserData& data, TextFormatter& formatter,
+                         bool prepend_newline = false)
         {
             if (auto t = get_custom_text(data, TextId::USAGE); t && t->empty())
                 return false;
 
-            auto text1 = write_custom_text(data, TextId::USAGE_TITLE,
+            auto text1 = write_custom_text(data, formatter,
+                                           TextId::USAGE_TITLE,
                                            prepend_newline);
             if (!text1)
             {
                 if (prepend_newline)
-                    data.text_formatter.newline();
-                data.text_formatter.write_words("USAGE");
-                data.text_formatter.newline();
+                    formatter.newline();
+                formatter.write_words("USAGE");
+                formatter.newline();
                 prepend_newline = false;
             }
             else
             {
                 prepend_newline = prepend_newline && is_empty(text1);
             }
-            auto text2 = write_custom_text(data, TextId::USAGE,
+            auto text2 = write_custom_text(data, formatter, TextId::USAGE,
                                            prepend_newline);
             if (text2)
                 return !is_empty(text1) || !is_empty(text2);
-            write_brief_usage(data, prepend_newline);
+            write_brief_usage(data, formatter, prepend_newline);
             return true;
         }
+    }
 
-        std::string get_name(ParserData& data, ArgumentId argument_id)
+    namespace
+    {
+        TextFormatter make_text_formatter(const ParserData& data,
+                                          std::ostream* stream,
+                                          unsigned line_width)
         {
-            for (const auto& a : data.arguments)
-            {
-                if (a->argument_id == argument_id)
-                    return a->name;
-            }
-            for (const auto& o : data.options)
+            TextFormatter formatter(stream, line_width);
+            for (const auto& rule : data.help_settings.word_splitting_rules)
+                formatter.word_splitter().add_word(rule);
+            return formatter;
+        }
+
+        void write_error_usage(const ParserData& data,
+                               TextFormatter& formatter)
+        {
+            if (!write_custom_text(data, formatter, TextId::ERROR_USAGE))
+                write_usage(data, formatter);
+        }
+
+        std::string make_string_literal(std::string_view str)
+        {
+            std::string result = "\"";
+            for (char c : str)
             {
-                if (o->argument_id == argument_id)
+                switch (c)
                 {
-                    std::string name = o->flags.front();
-                    for (size_t i = 1; i < o->flags.size(); ++i)
-                        name += ", " + o->flags[i];
-                    return name;
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\\':
+                    result += "\\\\";
+                    break;
+                case '\n':
+                    result += "\\n";
+                    break;
+                case '\t':
+                    result += "\\t";
+                    break;
+                default:
+                    if (auto uc = static_cast<unsigned char>(c);
+                        uc < 0x20 || uc >= 0x7F)
+                    {
+                        // Octal escapes are at most three digits long,
+                        // unlike hexadecimal ones.
+                        result.push_back('\\');
+                        result.push_back(char('0' + (uc >> 6)));
+                        result.push_back(char('0' + ((uc >> 3) & 7)));
+                        result.push_back(char('0' + (uc & 7)));
+                    }
+                    else
+                    {
+                        result.push_back(c);
+                    }
+                    break;
                 }
             }
-            return {};
+            result.push_back('"');
+            return result;
+        }
+
+        // Writes text as a sequence of string literals, one for each line.
+        void write_string_literals(std::ostream& stream, std::string_view text,
+                                   std::string_view indentation)
+        {
+            if (text.empty())
+            {
+                stream << indentation << "\"\"";
+                return;
+            }
+
+            while (!text.empty())
+            {
+                auto pos = text.find('\n');
+                auto line = text.substr(0, pos == std::string_view::npos
+                                           ? pos : pos + 1);
+                text.remove_prefix(line.size());
+                stream << indentation << make_string_literal(line);
+                if (!text.empty())
+                    stream << '\n';
+            }
         }
     }
 
-    void write_help_text(ParserData& data)
+    std::string format_help_text(const ParserData& data, unsigned line_width)
     {
-        if (data.help_settings.output_stream)
-            data.text_formatter.set_stream(data.help_settings.output_stream);
-        bool newline = !is_empty(write_custom_text(data, TextId::INITIAL_TEXT));
-        newline = write_usage(data, newline) || newline;
-        newline = !is_empty(write_custom_text(data, TextId::ABOUT, newline)) || newline;
-        write_argument_sections(data, newline);
-        write_custom_text(data, TextId::FINAL_TEXT, true);
+        // Use a new formatter, data can be shared between threads.
+        std::ostringstream ss;
+        auto formatter = make_text_formatter(data, &ss, line_width);
+        bool newline = !is_empty(write_custom_text(data, formatter,
+                                                   TextId::INITIAL_TEXT));
+        newline = write_usage(data, formatter, newline) || newline;
+        newline = !is_empty(write_custom_text(data, formatter, TextId::ABOUT,
+                                              newline)) || newline;
+        write_argument_sections(data, formatter, newline);
+        write_custom_text(data, formatter, TextId::FINAL_TEXT, true);
+        return ss.str();
     }
 
-    void write_error_message(ParserData& data, const std::string& msg)
+    std::string format_error_usage(const ParserData& data,
+                                   unsigned line_width)
     {
-        if (data.help_settings.output_stream)
-            data.text_formatter.set_stream(data.help_settings.output_stream);
-        else
-            data.text_formatter.set_stream(&std::cerr);
-        data.text_formatter.write_words(data.help_settings.program_name + ": ");
-        data.text_formatter.write_words(msg);
-        data.text_formatter.newline();
-        if (!write_custom_text(data, TextId::ERROR_USAGE))
-            write_usage(data);
+        std::ostringstream ss;
+        auto formatter = make_text_formatter(data, &ss, line_width);
+        write_error_usage(data, formatter);
+        return ss.str();
     }
 
-    void write_error_message(ParserData& data, const std::string& msg,
+    void write_help_text(const ParserData& data)
+    {
+        auto* stream = data.help_settings.output_stream;
+        if (!stream)
+            stream = &std::cout;
+
+        // The whole text is written with a single call, with std::cout
+        // that means a single fwrite when it's synchronized with stdio.
+        auto write = [&](const std::string& text)
+        {
+            stream->write(text.data(), std::streamsize(text.size()));
+        };
+
+        const auto width = get_help_text_width(data);
+        if (!data.finalized || data.has_dynamic_texts)
+        {
+            write(format_help_text(data, width));
+            return;
+        }
+
+        auto& cache = data.help_text_cache;
+        const std::string* text;
+        {
+            std::lock_guard lock(cache.mutex);
+            auto it = cache.texts.find(width);
+            if (it == cache.texts.end())
+            {
+                it = cache.texts.emplace(width,
+                                         format_help_text(data, width)).first;
+            }
+            text = &it->second;
+        }
+        write(*text);
+    }
+
+    void write_error_message(const ParserData& data, const std::string& msg)
+    {
+        auto* stream = data.help_settings.output_stream;
+        if (!stream)
+            stream = &std::cerr;
+        auto formatter = make_text_formatter(data, stream,
+                                             get_help_text_width(data));
+        formatter.write_words(data.help_settings.program_name + ": ");
+        formatter.write_words(msg);
+        formatter.newline();
+        write_error_usage(data, formatter);
+    }
+
+    void write_error_message(const ParserData& data, const std::string& msg,
                              ArgumentId argument_id)
     {
-        if (auto name = get_name(data, argument_id); !name.empty())
+        if (auto name = find_argument_name(data, argument_id); !name.empty())
             write_error_message(data, name + ": " + msg);
         else
             write_error_message(data, msg);
     }
+
+    void write_precompiled_help_header(
+        const std::vector<const ParserData*>& parsers,
+        const std::vector<unsigned>& line_widths,
+        std::ostream& stream)
+    {
+        stream << "// Generated by Argos from the program's parser definitions."
+                  " Do not edit.\n"
+                  "#pragma once\n"
+                  "#include <Argos/PrecompiledHelp.hpp>\n"
+                  "\n"
+                  "namespace argos_precompiled_help\n"
+                  "{\n"
+                  "    inline constexpr argos::PrecompiledHelpText TEXTS[] = {\n";
+        for (const auto* data : parsers)
+        {
+            for (auto width : line_widths)
+            {
+                stream << "        {"
+                       << make_string_literal(data->help_settings.program_name)
+                       << ", " << width << ",\n";
+                write_string_literals(stream, format_help_text(*data, width),
+                                      "            ");
+                stream << ",\n";
+                write_string_literals(stream, format_error_usage(*data, width),
+                                      "            ");
+                stream << "},\n";
+            }
+        }
+        stream << "    };\n"
+                  "\n"
+                  "    inline const bool IS_REGISTERED =\n"
+                  "        argos::set_precompiled_help_texts(TEXTS);\n"
+                  "}\n";
+    }
 }
@@ -7,15 +7,44 @@
 //****************************************************************************
 #pragma once
 
+#include "Argos/PrecompiledHelp.hpp"
 #include "ParserData.hpp"
 
+// The functions below are implemented by HelpText.cpp, or by
+// PrecompiledHelpText.cpp in the ArgosPrecompiledHelp library, where the
+// texts are formatted at build time. find_precompiled_help_text is
+// implemented by PrecompiledHelp.cpp.
+
 namespace argos
 {
-    void write_help_text(ParserData& data);
+    std::string format_help_text(const ParserData& data, unsigned line_width);
+
+    // Returns the text that follows the message in error messages.
+    std::string format_error_usage(const ParserData& data,
+                                   unsigned line_width);
+
+    // Writes the help text to the parser's output stream. The text is
+    // formatted once for each line width and cached in data, unless data
+    // contains dynamic texts.
+    void write_help_text(const ParserData& data);
 
-    void write_error_message(ParserData& data, const std::string& msg);
+    void write_error_message(const ParserData& data, const std::string& msg);
 
-    void write_error_message(ParserData& data,
+    void write_error_message(const ParserData& data,
                              const std::string& msg,
                              ArgumentId argument_id);
+
+    // Writes a header with the help texts of parsers formatted for each
+    // of line_widths. The header registers the texts with
+    // set_precompiled_help_texts().
+    void write_precompiled_help_header(
+        const std::vector<const ParserData*>& parsers,
+        const std::vector<unsigned>& line_widths,
+        std::ostream& stream);
+
+    // Returns the registered text for program_name that best fits
+    // line_width, or nullptr if there isn't one.
+    const PrecompiledHelpText*
+    find_precompiled_help_text(std::string_view program_name,
+                               unsigned line_width);
 }
@@ -18,15 +18,20 @@ namespace argos
     public:
         virtual ~IOptionIterator() = default;
 
-        virtual std::optional<std::string> next() = 0;
+        virtual std::optional<std::string_view> next() = 0;
 
-        virtual std::optional<std::string> next_value() = 0;
+        virtual std::optional<std::string_view> next_value() = 0;
 
         [[nodiscard]] virtual std::string_view current() const = 0;
 
-        [[nodiscard]] virtual std::vector<std::string_view>
-        remaining_arguments() const = 0;
+        // Returns the arguments after the current one and moves past them.
+        // Arguments from an IArgumentSource are returned one batch at a
+        // time, call this until it returns an empty vector.
+        virtual std::vector<std::string_view> remaining_arguments() = 0;
 
-        [[nodiscard]] virtual IOptionIterator* clone() const = 0;
+        // Restarts the iteration on args. The iterator swaps its argument
+        // list with args, which lets the caller reuse the capacity of the
+        // previous list.
+        virtual void reset(std::vector<std::string_view>& args) = 0;
     };
 }
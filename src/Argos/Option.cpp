@@ -7,11 +7,34 @@
 //****************************************************************************
 #include "Argos/Option.hpp"
 
+#include <charconv>
 #include "ArgosThrow.hpp"
 #include "OptionData.hpp"
 
+#ifndef __cpp_lib_to_chars
+    #include <cstdio>
+#endif
+
 namespace argos
 {
+    namespace
+    {
+        // Returns a string that parse_floating_point converts back to
+        // value, the shortest one if the library has to_chars for double.
+        std::string format_double(double value)
+        {
+            char buffer[32];
+#ifdef __cpp_lib_to_chars
+            auto end = std::to_chars(std::begin(buffer), std::end(buffer),
+                                     value).ptr;
+            return {buffer, size_t(end - buffer)};
+#else
+            snprintf(buffer, sizeof(buffer), "%.17g", value);
+            return buffer;
+#endif
+        }
+    }
+
     Option::Option()
         : m_option(std::make_unique<OptionData>())
     {}
@@ -59,10 +82,11 @@ namespace argos
         return *this;
     }
 
-    Option& Option::help(TextCallback callback)
+    Option& Option::help(TextCallback callback,
+                         TextCallbackMode mode)
     {
         check_option();
-        m_option->help = callback;
+        m_option->help = make_text_source(std::move(callback), mode);
         return *this;
     }
 
@@ -126,6 +150,41 @@ namespace argos
     {
         check_option();
         m_option->initial_value = value;
+        m_option->typed_initial_value = {};
+        return *this;
+    }
+
+    Option& Option::initial_value(const char* value)
+    {
+        return this->initial_value(std::string(value));
+    }
+
+    Option& Option::initial_value(bool value)
+    {
+        check_option();
+        m_option->initial_value = value ? "1" : "0";
+        m_option->typed_initial_value = value;
+        return *this;
+    }
+
+    Option& Option::initial_value(int value)
+    {
+        return this->initial_value(static_cast<long long>(value));
+    }
+
+    Option& Option::initial_value(long long value)
+    {
+        check_option();
+        m_option->initial_value = std::to_string(value);
+        m_option->typed_initial_value = value;
+        return *this;
+    }
+
+    Option& Option::initial_value(double value)
+    {
+        check_option();
+        m_option->initial_value = format_double(value);
+        m_option->typed_initial_value = value;
         return *this;
     }
 
@@ -138,12 +197,16 @@ namespace argos
     {
         check_option();
         m_option->constant = value;
+        m_option->typed_constant = {};
         return *this;
     }
 
     Option& Option::constant(bool value)
     {
-        return this->constant(value ? 1LL : 0LL);
+        check_option();
+        m_option->constant = value ? "1" : "0";
+        m_option->typed_constant = value;
+        return *this;
     }
 
     Option& Option::constant(int value)
@@ -155,6 +218,25 @@ namespace argos
     {
         check_option();
         m_option->constant = std::to_string(value);
+        m_option->typed_constant = value;
+        return *this;
+    }
+
+    Option& Option::constant(double value)
+    {
+        check_option();
+        m_option->constant = format_double(value);
+        m_option->typed_constant = value;
+        return *this;
+    }
+
+    Option& Option::limits(long long min, long long max)
+    {
+        check_option();
+        if (min > max)
+            ARGOS_THROW("The minimum count can't be greater than the maximum.");
+        m_option->min_count = min;
+        m_option->max_count = max;
         return *this;
     }
 
@@ -165,6 +247,13 @@ namespace argos
         return *this;
     }
 
+    Option& Option::bind(std::shared_ptr<IValueBinding> binding)
+    {
+        check_option();
+        m_option->binding = std::move(binding);
+        return *this;
+    }
+
     Option& Option::type(OptionType type)
     {
         check_option();
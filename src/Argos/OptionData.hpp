@@ -6,14 +6,22 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <limits>
 #include <string>
+#include <variant>
 #include <vector>
 #include "Argos/Callbacks.hpp"
 #include "Argos/Enums.hpp"
+#include "Argos/ValueBinding.hpp"
 #include "TextSource.hpp"
 
 namespace argos
 {
+    // A constant or initial value that was given as a bool or a number.
+    // The value is also stored as a string, this lets ArgumentValue
+    // skip parsing it.
+    using TypedValue = std::variant<std::monostate, bool, long long, double>;
+
     struct OptionData
     {
         std::vector<std::string> flags;
@@ -23,7 +31,14 @@ namespace argos
         std::string argument;
         std::string constant;
         std::string initial_value;
+        TypedValue typed_constant;
+        TypedValue typed_initial_value;
         OptionCallback callback;
+        std::shared_ptr<IValueBinding> binding;
+        // COUNT-options only.
+        long long count_step = 1;
+        long long min_count = std::numeric_limits<long long>::min();
+        long long max_count = std::numeric_limits<long long>::max();
         OptionOperation operation = OptionOperation::ASSIGN;
         OptionType type = OptionType::NORMAL;
         Visibility visibility = Visibility::NORMAL;
@@ -6,6 +6,8 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
+#include <memory>
+#include "Argos/IArgumentSource.hpp"
 #include "IOptionIterator.hpp"
 
 namespace argos
@@ -18,21 +20,25 @@ namespace argos
         explicit OptionIterator(std::vector<std::string_view> args,
                                 char prefix);
 
-        OptionIterator(const OptionIterator& rhs);
+        OptionIterator(std::unique_ptr<IArgumentSource> source, char prefix);
 
-        std::optional<std::string> next() final;
+        std::optional<std::string_view> next() final;
 
-        std::optional<std::string> next_value() final;
+        std::optional<std::string_view> next_value() final;
 
         [[nodiscard]] std::string_view current() const final;
 
-        [[nodiscard]] std::vector<std::string_view> remaining_arguments() const final;
+        std::vector<std::string_view> remaining_arguments() final;
 
-        [[nodiscard]] OptionIterator* clone() const final;
+        void reset(std::vector<std::string_view>& args) final;
     private:
+        bool at_end();
+
         std::vector<std::string_view> m_args;
         std::vector<std::string_view>::const_iterator m_args_it;
         size_t m_pos = 0;
+        std::unique_ptr<IArgumentSource> m_source;
+        bool m_end_of_source = false;
         char m_prefix = '-';
     };
 }
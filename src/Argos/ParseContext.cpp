@@ -0,0 +1,21 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Argos/ParseContext.hpp"
+
+#include "ArgumentIteratorImpl.hpp"
+
+namespace argos
+{
+    ParseContext::ParseContext() = default;
+
+    ParseContext::ParseContext(ParseContext&&) noexcept = default;
+
+    ParseContext::~ParseContext() = default;
+
+    ParseContext& ParseContext::operator=(ParseContext&&) noexcept = default;
+}
@@ -8,118 +8,169 @@
 
 #include "ParseValue.hpp"
 
-#include <cerrno>
-#include <climits>
-#include <cstdlib>
-#include "StringUtilities.hpp"
+#include <charconv>
+#include <limits>
+#include <type_traits>
+
+#ifndef __cpp_lib_to_chars
+    #include <cerrno>
+    #include <cstdlib>
+    #include <string>
+#endif
 
 namespace argos
 {
     namespace
     {
-        template <typename T>
-        T str_to_int(const char* str, char** endp, int base);
-
-        template <>
-        long str_to_int<long>(const char* str, char** endp, int base)
-        {
-            return strtol(str, endp, base);
-        }
-
-        template <>
-        long long str_to_int<long long>(const char* str, char** endp, int base)
+        bool is_space(char c)
         {
-            return strtoll(str, endp, base);
+            return c == ' ' || ('\t' <= c && c <= '\r');
         }
 
-        template <>
-        unsigned long
-        str_to_int<unsigned long>(const char* str, char** endp, int base)
+        // Removes the leading white space and the optional sign, and
+        // returns true if the sign was a minus. strtol and strtod both
+        // accept leading white space, but from_chars doesn't.
+        bool remove_sign(std::string_view& str)
         {
-            return strtoul(str, endp, base);
+            size_t i = 0;
+            while (i < str.size() && is_space(str[i]))
+                ++i;
+            bool negative = false;
+            if (i < str.size() && (str[i] == '-' || str[i] == '+'))
+                negative = str[i++] == '-';
+            str.remove_prefix(i);
+            return negative;
         }
 
-        template <>
-        unsigned long long
-        str_to_int<unsigned long long>(const char* str, char** endp, int base)
+        bool remove_hex_prefix(std::string_view& str)
         {
-            return strtoull(str, endp, base);
+            if (str.size() < 2 || str[0] != '0' || (str[1] | 0x20) != 'x')
+                return false;
+            str.remove_prefix(2);
+            return true;
         }
 
         template <typename T>
-        std::optional<T> parse_integer_impl(const std::string& str, int base)
+        std::optional<T> parse_integer_impl(std::string_view str, int base)
         {
-            if (str.empty())
+            if (base != 0 && (base < 2 || 36 < base))
                 return {};
-            char* endp = nullptr;
-            errno = 0;
-            auto value = str_to_int<T>(str.c_str(), &endp, base);
-            if (endp == str.c_str() + str.size() && errno == 0)
-                return value;
-            return {};
+
+            const bool negative = remove_sign(str);
+            if (base == 0)
+            {
+                if (remove_hex_prefix(str))
+                    base = 16;
+                else if (str.size() > 1 && str[0] == '0')
+                    base = 8;
+                else
+                    base = 10;
+            }
+            else if (base == 16)
+            {
+                remove_hex_prefix(str);
+            }
+
+            // The magnitude is parsed as an unsigned number to detect
+            // overflow exactly, also for the most negative value of T.
+            using U = std::make_unsigned_t<T>;
+            U magnitude = 0;
+            const auto* end = str.data() + str.size();
+            auto [ptr, ec] = std::from_chars(str.data(), end, magnitude, base);
+            if (str.empty() || ec != std::errc() || ptr != end)
+                return {};
+
+            if constexpr (std::is_signed_v<T>)
+            {
+                constexpr auto max = U(std::numeric_limits<T>::max());
+                if (!negative)
+                {
+                    if (magnitude > max)
+                        return {};
+                    return T(magnitude);
+                }
+                if (magnitude > max + 1)
+                    return {};
+                if (magnitude == max + 1)
+                    return std::numeric_limits<T>::min();
+                return T(-T(magnitude));
+            }
+            else
+            {
+                if (negative && magnitude != 0)
+                    return {};
+                return magnitude;
+            }
         }
     }
 
     template <>
-    std::optional<int> parse_integer<int>(const std::string& str, int base)
+    std::optional<int> parse_integer<int>(std::string_view str, int base)
     {
-        auto n = parse_integer_impl<long>(str, base);
-        if (!n)
-            return {};
-
-        if constexpr (sizeof(int) != sizeof(long))
-        {
-            if (*n < INT_MIN || INT_MAX < *n)
-                return {};
-        }
-        return static_cast<int>(*n);
+        return parse_integer_impl<int>(str, base);
     }
 
     template <>
     std::optional<unsigned>
-    parse_integer<unsigned>(const std::string& str, int base)
+    parse_integer<unsigned>(std::string_view str, int base)
     {
-        auto n = parse_integer_impl<unsigned long>(str, base);
-        if (!n)
-            return {};
-
-        if constexpr (sizeof(unsigned) != sizeof(unsigned long))
-        {
-            if (UINT_MAX < *n)
-                return {};
-        }
-        return static_cast<unsigned>(*n);
+        return parse_integer_impl<unsigned>(str, base);
     }
 
     template <>
-    std::optional<long> parse_integer<long>(const std::string& str, int base)
+    std::optional<long> parse_integer<long>(std::string_view str, int base)
     {
         return parse_integer_impl<long>(str, base);
     }
 
     template <>
     std::optional<long long>
-    parse_integer<long long>(const std::string& str, int base)
+    parse_integer<long long>(std::string_view str, int base)
     {
         return parse_integer_impl<long long>(str, base);
     }
 
     template <>
     std::optional<unsigned long>
-    parse_integer<unsigned long>(const std::string& str, int base)
+    parse_integer<unsigned long>(std::string_view str, int base)
     {
         return parse_integer_impl<unsigned long>(str, base);
     }
 
     template <>
     std::optional<unsigned long long>
-    parse_integer<unsigned long long>(const std::string& str, int base)
+    parse_integer<unsigned long long>(std::string_view str, int base)
     {
         return parse_integer_impl<unsigned long long>(str, base);
     }
 
     namespace
     {
+#ifdef __cpp_lib_to_chars
+
+        template <typename T>
+        std::optional<T> parse_floating_point_impl(std::string_view str)
+        {
+            const bool negative = remove_sign(str);
+            auto format = std::chars_format::general;
+            if (remove_hex_prefix(str))
+                format = std::chars_format::hex;
+
+            // from_chars accepts a minus, but the sign has already been
+            // removed.
+            if (str.empty() || str[0] == '-')
+                return {};
+
+            T value = 0;
+            const auto* end = str.data() + str.size();
+            auto [ptr, ec] = std::from_chars(str.data(), end, value, format);
+            if (ec != std::errc() || ptr != end)
+                return {};
+            return negative ? -value : value;
+        }
+
+#else
+
         template <typename T>
         T str_to_float(const char* str, char** endp);
 
@@ -135,28 +186,34 @@ namespace argos
             return strtod(str, endp);
         }
 
+        // Fallback for standard libraries without floating point
+        // from_chars. Unlike the from_chars version, it depends on the
+        // current locale.
         template <typename T>
-        std::optional<T> parse_floating_point_impl(const std::string& str)
+        std::optional<T> parse_floating_point_impl(std::string_view str)
         {
             if (str.empty())
                 return {};
+            std::string s(str);
             char* endp = nullptr;
             errno = 0;
-            auto value = str_to_float<T>(str.c_str(), &endp);
-            if (endp == str.c_str() + str.size() && errno == 0)
+            auto value = str_to_float<T>(s.c_str(), &endp);
+            if (endp == s.c_str() + s.size() && errno == 0)
                 return value;
             return {};
         }
+
+#endif
     }
 
     template <>
-    std::optional<float> parse_floating_point<float>(const std::string& str)
+    std::optional<float> parse_floating_point<float>(std::string_view str)
     {
         return parse_floating_point_impl<float>(str);
     }
 
     template <>
-    std::optional<double> parse_floating_point<double>(const std::string& str)
+    std::optional<double> parse_floating_point<double>(std::string_view str)
     {
         return parse_floating_point_impl<double>(str);
     }
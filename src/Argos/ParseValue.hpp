@@ -6,45 +6,62 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
-#include <cerrno>
-#include <cinttypes>
 #include <optional>
-#include <string>
-#include <type_traits>
+#include <string_view>
+#include <vector>
 
 namespace argos
 {
     template <typename T>
-    std::optional<T> parse_integer(const std::string& str, int base);
+    std::optional<T> parse_integer(std::string_view str, int base);
 
     template <>
-    std::optional<int> parse_integer<int>(const std::string& str, int base);
+    std::optional<int> parse_integer<int>(std::string_view str, int base);
 
     template <>
     std::optional<unsigned>
-    parse_integer<unsigned>(const std::string& str, int base);
+    parse_integer<unsigned>(std::string_view str, int base);
 
     template <>
-    std::optional<long> parse_integer<long>(const std::string& str, int base);
+    std::optional<long> parse_integer<long>(std::string_view str, int base);
 
     template <>
     std::optional<long long>
-    parse_integer<long long>(const std::string& str, int base);
+    parse_integer<long long>(std::string_view str, int base);
 
     template <>
     std::optional<unsigned long>
-    parse_integer<unsigned long>(const std::string& str, int base);
+    parse_integer<unsigned long>(std::string_view str, int base);
 
     template <>
     std::optional<unsigned long long>
-    parse_integer<unsigned long long>(const std::string& str, int base);
+    parse_integer<unsigned long long>(std::string_view str, int base);
 
     template <typename T>
-    std::optional<T> parse_floating_point(const std::string& str);
+    std::optional<T> parse_floating_point(std::string_view str);
 
     template <>
-    std::optional<float> parse_floating_point<float>(const std::string& str);
+    std::optional<float> parse_floating_point<float>(std::string_view str);
 
     template <>
-    std::optional<double> parse_floating_point<double>(const std::string& str);
+    std::optional<double> parse_floating_point<double>(std::string_view str);
+
+    // Splits str on separator and appends the parts converted by parse
+    // to values. Returns false if a part can't be converted.
+    template <typename T, typename ParseFunc>
+    bool parse_parts(std::string_view str, char separator, ParseFunc parse,
+                     std::vector<T>& values)
+    {
+        while (true)
+        {
+            const auto pos = str.find(separator);
+            auto value = parse(str.substr(0, pos));
+            if (!value)
+                return false;
+            values.push_back(*value);
+            if (pos == std::string_view::npos)
+                return true;
+            str.remove_prefix(pos + 1);
+        }
+    }
 }
@@ -42,14 +42,14 @@ namespace argos
         return m_impl->has(arg.value_id());
     }
 
+    bool ParsedArguments::has(ValueHandle handle) const
+    {
+        return m_impl->has(m_impl->get_value_id(handle));
+    }
+
     ArgumentValue ParsedArguments::value(const std::string& name) const
     {
-        auto id = m_impl->get_value_id(name);
-        auto value = m_impl->get_value(id);
-        if (value)
-            return {value->first, m_impl, id, value->second};
-        else
-            return {{}, m_impl, id, {}};
+        return value(m_impl->get_value_handle(name));
     }
 
     ArgumentValue ParsedArguments::value(const IArgumentView& arg) const
@@ -61,11 +61,19 @@ namespace argos
             return {{}, m_impl, arg.value_id(), arg.argument_id()};
     }
 
+    ArgumentValue ParsedArguments::value(ValueHandle handle) const
+    {
+        auto id = m_impl->get_value_id(handle);
+        auto value = m_impl->get_value(id);
+        if (value)
+            return {value->first, m_impl, id, value->second};
+        else
+            return {{}, m_impl, id, {}};
+    }
+
     ArgumentValues ParsedArguments::values(const std::string& name) const
     {
-        auto id = m_impl->get_value_id(name);
-        auto values = m_impl->get_values(id);
-        return {values, m_impl, id};
+        return values(m_impl->get_value_handle(name));
     }
 
     ArgumentValues ParsedArguments::values(const IArgumentView& arg) const
@@ -74,6 +82,18 @@ namespace argos
         return {values, m_impl, arg.value_id()};
     }
 
+    ArgumentValues ParsedArguments::values(ValueHandle handle) const
+    {
+        auto id = m_impl->get_value_id(handle);
+        auto values = m_impl->get_values(id);
+        return {values, m_impl, id};
+    }
+
+    ValueHandle ParsedArguments::value_handle(const std::string& name) const
+    {
+        return m_impl->get_value_handle(name);
+    }
+
     std::vector<std::unique_ptr<ArgumentView>>
     ParsedArguments::all_arguments() const
     {
@@ -97,6 +117,11 @@ namespace argos
         return m_impl->result_code();
     }
 
+    const std::string& ParsedArguments::error_message() const
+    {
+        return m_impl->error_message();
+    }
+
     OptionView ParsedArguments::stop_option() const
     {
         const auto* option = m_impl->stop_option();
@@ -105,6 +130,20 @@ namespace argos
         return OptionView(option);
     }
 
+    const std::string& ParsedArguments::subcommand() const
+    {
+        static const std::string empty;
+        const auto* subcommand = m_impl->subcommand();
+        return subcommand ? subcommand->name : empty;
+    }
+
+    const ParsedArguments& ParsedArguments::subcommand_arguments() const
+    {
+        if (!m_impl->subcommand())
+            ARGOS_THROW("No subcommand was selected.");
+        return m_impl->subcommand_arguments();
+    }
+
     const std::vector<std::string>&
     ParsedArguments::unprocessed_arguments() const
     {
@@ -21,7 +21,8 @@ namespace argos
     ParsedArgumentsBuilder::append(const std::string& name,
                                    const std::string& value)
     {
-        m_impl->append_value(m_impl->get_value_id(name), value, {});
+        m_impl->append_value(m_impl->get_value_id(name),
+                             m_impl->store_string(value), {});
         return *this;
     }
 
@@ -29,7 +30,8 @@ namespace argos
     ParsedArgumentsBuilder::append(const IArgumentView& arg,
                                    const std::string& value)
     {
-        m_impl->append_value(arg.value_id(), value, arg.argument_id());
+        m_impl->append_value(arg.value_id(), m_impl->store_string(value),
+                             arg.argument_id());
         return *this;
     }
 
@@ -37,7 +39,8 @@ namespace argos
     ParsedArgumentsBuilder::assign(const std::string& name,
                                    const std::string& value)
     {
-        m_impl->assign_value(m_impl->get_value_id(name), value, {});
+        m_impl->assign_value(m_impl->get_value_id(name),
+                             m_impl->store_string(value), {});
         return *this;
     }
 
@@ -45,7 +48,8 @@ namespace argos
     ParsedArgumentsBuilder::assign(const IArgumentView& arg,
                                    const std::string& value)
     {
-        m_impl->assign_value(arg.value_id(), value, arg.argument_id());
+        m_impl->assign_value(arg.value_id(), m_impl->store_string(value),
+                             arg.argument_id());
         return *this;
     }
 
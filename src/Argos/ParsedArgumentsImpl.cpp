@@ -9,68 +9,43 @@
 
 #include <algorithm>
 #include <cassert>
+#include <charconv>
+#include <functional>
+#include <limits>
 #include "Argos/ArgumentView.hpp"
 #include "Argos/OptionView.hpp"
 #include "ArgosThrow.hpp"
+#include "CommandLineTokenizer.hpp"
 #include "HelpText.hpp"
+#include "ParseValue.hpp"
 
 namespace argos
 {
     namespace
     {
-        template <typename It, typename Value, typename IsLess>
-        It lower_bound(It begin, It end, Value&& v, IsLess is_less)
+        long long saturating_add(long long a, long long b)
         {
-            while (begin != end)
-            {
-                auto offset = std::distance(begin, end) / 2;
-                auto mid = begin + offset;
-                if (is_less(*mid, v))
-                    begin = mid + 1;
-                else
-                    end = mid;
-            }
-            return begin;
+            using limits = std::numeric_limits<long long>;
+            if (b > 0 && a > limits::max() - b)
+                return limits::max();
+            if (b < 0 && a < limits::min() - b)
+                return limits::min();
+            return a + b;
         }
     }
 
-    ParsedArgumentsImpl::ParsedArgumentsImpl(std::shared_ptr<ParserData> data)
+    ParsedArgumentsImpl::ParsedArgumentsImpl(
+            std::shared_ptr<const ParserData> data)
         : m_data(std::move(data))
     {
-        assert(m_data);
-        for (auto& a : m_data->arguments)
-        {
-            m_ids.emplace_back(a->name, a->value_id, a->argument_id);
-            if (!a->value.empty())
-                m_ids.emplace_back(a->value, a->value_id, a->argument_id);
-        }
-        for (auto& o : m_data->options)
-        {
-            if (o->operation == OptionOperation::NONE)
-                continue;
-
-            for (auto& f : o->flags)
-                m_ids.emplace_back(f, o->value_id, o->argument_id);
-            if (!o->alias.empty())
-                m_ids.emplace_back(o->alias, o->value_id, o->argument_id);
-        }
-        if (!m_ids.empty())
-        {
-            using std::get;
-            sort(m_ids.begin(), m_ids.end());
-            for (auto it = next(m_ids.begin()); it != m_ids.end(); ++it)
-            {
-                auto p = prev(it);
-                if (get<0>(*it) == get<0>(*p) && get<2>(*it) != get<2>(*p))
-                    get<2>(*it) = get<2>(*p) = {};
-            }
-            m_ids.erase(unique(m_ids.begin(), m_ids.end()), m_ids.end());
-        }
+        assert(m_data && m_data->finalized);
+        m_values.resize(m_data->value_count + 1);
     }
 
     bool ParsedArgumentsImpl::has(ValueId value_id) const
     {
-        return m_values.find(value_id) != m_values.end();
+        const auto* values = find_values(value_id);
+        return values && !values->empty();
     }
 
     const std::vector<std::string>&
@@ -79,73 +54,186 @@ namespace argos
         return m_unprocessed_arguments;
     }
 
-    void ParsedArgumentsImpl::add_unprocessed_argument(const std::string& arg)
+    void ParsedArgumentsImpl::add_unprocessed_argument(std::string_view arg)
     {
-        m_unprocessed_arguments.push_back(arg);
+        m_unprocessed_arguments.emplace_back(arg);
+    }
+
+    std::string_view ParsedArgumentsImpl::store_string(std::string_view str)
+    {
+        return m_strings.add(str);
+    }
+
+    std::string_view
+    ParsedArgumentsImpl::store_argument(std::string_view arg)
+    {
+        if (m_data->parser_settings.borrow_arguments)
+            return arg;
+        if (m_response_files && m_response_files->contains(arg))
+            return arg;
+        std::less_equal<const char*> less_equal;
+        if (less_equal(m_command_line.data(), arg.data())
+            && less_equal(arg.data() + arg.size(),
+                          m_command_line.data() + m_command_line.size()))
+        {
+            return arg;
+        }
+        return m_strings.add(arg);
+    }
+
+    void
+    ParsedArgumentsImpl::store_command_line(std::string_view command_line,
+                                            std::vector<std::string_view>& args)
+    {
+        m_command_line = command_line;
+        args.clear();
+        args.reserve(max_token_count(m_command_line));
+        tokenize_command_line(m_command_line.data(), m_command_line.size(),
+                              args);
+    }
+
+    void ParsedArgumentsImpl::clear()
+    {
+        for (auto& values : m_values)
+            values.clear();
+        for (auto& count : m_counts)
+            count.active = false;
+        m_strings.clear();
+        m_unprocessed_arguments.clear();
+        m_result_code = ParserResultCode::NONE;
+        m_stop_option = nullptr;
+        m_error_message.clear();
+        m_response_files.reset();
+        m_command_line.clear();
+        m_subcommand = nullptr;
+        m_subcommand_arguments = {};
+    }
+
+    void ParsedArgumentsImpl::set_response_files(
+        std::unique_ptr<ResponseFiles> files)
+    {
+        m_response_files = std::move(files);
     }
 
     std::string_view
     ParsedArgumentsImpl::assign_value(ValueId value_id,
-                                      const std::string& value,
+                                      std::string_view value,
                                       ArgumentId argument_id)
     {
-        auto it = m_values.lower_bound(value_id);
-        if (it == m_values.end() || it->first != value_id)
-            return append_value(value_id, value, argument_id);
-
-        it->second = {value, argument_id};
-        auto nxt = next(it);
-        while (nxt != m_values.end() && nxt->first == value_id)
-            m_values.erase(nxt++);
-        return it->second.first;
+        auto& values = this->values(value_id);
+        values.clear();
+        values.push_back({value, argument_id});
+        reset_count(value_id);
+        return value;
     }
 
     std::string_view
     ParsedArgumentsImpl::append_value(ValueId value_id,
-                                      const std::string& value,
+                                      std::string_view value,
                                       ArgumentId argument_id)
     {
-        return m_values.insert({value_id, {value, argument_id}})->second.first;
+        values(value_id).push_back({value, argument_id});
+        reset_count(value_id);
+        return value;
     }
 
     void ParsedArgumentsImpl::clear_value(ValueId value_id)
     {
-        m_values.erase(value_id);
+        values(value_id).clear();
+        reset_count(value_id);
+    }
+
+    std::string_view
+    ParsedArgumentsImpl::count_value(ValueId value_id,
+                                     long long step,
+                                     long long min,
+                                     long long max,
+                                     ArgumentId argument_id,
+                                     bool bound)
+    {
+        auto& values = this->values(value_id);
+        auto& count = this->count(value_id);
+
+        long long n = 0;
+        if (count.active)
+            n = count.value;
+        else if (!bound && !values.empty())
+            n = parse_integer<long long>(values.end()[-1].first, 10)
+                    .value_or(0);
+        n = std::clamp(saturating_add(n, step), min, max);
+
+        count.value = n;
+        count.active = true;
+        count.bound = bound;
+        auto* end = std::to_chars(std::begin(count.text),
+                                  std::end(count.text), n).ptr;
+        std::string_view text(count.text, size_t(end - count.text));
+        values.clear();
+        values.push_back({bound ? std::string_view() : text, argument_id});
+        return text;
+    }
+
+    void ParsedArgumentsImpl::set_bound_count(ValueId value_id,
+                                              long long value)
+    {
+        auto& count = this->count(value_id);
+        count.value = value;
+        count.active = true;
+        count.bound = true;
+    }
+
+    const long long* ParsedArgumentsImpl::find_count(ValueId value_id) const
+    {
+        auto index = size_t(value_id);
+        if (index >= m_counts.size() || !m_counts[index].active
+            || m_counts[index].bound)
+        {
+            return nullptr;
+        }
+        return &m_counts[index].value;
     }
 
     ValueId
     ParsedArgumentsImpl::get_value_id(std::string_view value_name) const
     {
-        using std::get;
-        auto it = lower_bound(m_ids.begin(), m_ids.end(), value_name,
-                              [](auto& p, auto& s) {return get<0>(p) < s;});
-        if (it == m_ids.end() || get<0>(*it) != value_name)
-            ARGOS_THROW("Unknown value: " + std::string(value_name));
-        return get<1>(*it);
+        return argos::get_value_id(*m_data, value_name);
+    }
+
+    ValueHandle
+    ParsedArgumentsImpl::get_value_handle(std::string_view value_name) const
+    {
+        return {get_value_id(value_name), m_data->generation};
+    }
+
+    ValueId ParsedArgumentsImpl::get_value_id(ValueHandle handle) const
+    {
+        auto index = size_t(handle.value_id());
+        if (handle.generation() != m_data->generation
+            || index == 0 || index > m_data->value_count)
+        {
+            ARGOS_THROW("Invalid value handle.");
+        }
+        return handle.value_id();
     }
 
     std::optional<std::pair<std::string_view, ArgumentId>>
     ParsedArgumentsImpl::get_value(ValueId value_id) const
     {
-        auto it = m_values.lower_bound(value_id);
-        if (it == m_values.end() || it->first != value_id)
+        const auto* values = find_values(value_id);
+        if (!values || values->empty())
             return {};
-        auto nx = next(it);
-        if (nx != m_values.end() && nx->first == value_id)
+        if (values->size() != 1)
             ARGOS_THROW("Attempt to read multiple values as a single value.");
-        return it->second;
+        return values->front();
     }
 
     std::vector<std::pair<std::string_view, ArgumentId>>
     ParsedArgumentsImpl::get_values(ValueId value_id) const
     {
-        std::vector<std::pair<std::string_view, ArgumentId>> result;
-        for (auto it = m_values.lower_bound(value_id);
-             it != m_values.end() && it->first == value_id; ++it)
-        {
-            result.emplace_back(it->second);
-        }
-        return result;
+        const auto* values = find_values(value_id);
+        if (!values)
+            return {};
+        return {values->begin(), values->end()};
     }
 
     std::vector<std::unique_ptr<IArgumentView>>
@@ -181,7 +269,8 @@ namespace argos
         return {};
     }
 
-    const std::shared_ptr<ParserData>& ParsedArgumentsImpl::parser_data() const
+    const std::shared_ptr<const ParserData>&
+    ParsedArgumentsImpl::parser_data() const
     {
         return m_data;
     }
@@ -196,11 +285,38 @@ namespace argos
         m_result_code = result_code;
     }
 
+    const std::string& ParsedArgumentsImpl::error_message() const
+    {
+        return m_error_message;
+    }
+
+    void ParsedArgumentsImpl::set_error_message(std::string message)
+    {
+        m_error_message = std::move(message);
+    }
+
     const OptionData* ParsedArgumentsImpl::stop_option() const
     {
         return m_stop_option;
     }
 
+    const SubcommandData* ParsedArgumentsImpl::subcommand() const
+    {
+        return m_subcommand;
+    }
+
+    const ParsedArguments& ParsedArgumentsImpl::subcommand_arguments() const
+    {
+        return m_subcommand_arguments;
+    }
+
+    void ParsedArgumentsImpl::set_subcommand(const SubcommandData* subcommand,
+                                             ParsedArguments arguments)
+    {
+        m_subcommand = subcommand;
+        m_subcommand_arguments = std::move(arguments);
+    }
+
     void ParsedArgumentsImpl::set_breaking_option(const OptionData* option)
     {
         m_result_code = ParserResultCode::STOP;
@@ -209,7 +325,8 @@ namespace argos
 
     void ParsedArgumentsImpl::error(const std::string& message)
     {
-        write_error_message(*m_data, message);
+        if (m_data->parser_settings.write_error_messages)
+            write_error_message(*m_data, message);
         if (m_data->parser_settings.auto_exit)
             exit(m_data->parser_settings.error_exit_code);
         else
@@ -219,10 +336,41 @@ namespace argos
     void ParsedArgumentsImpl::error(const std::string& message,
                                     ArgumentId argument_id)
     {
-        write_error_message(*m_data, message, argument_id);
+        if (m_data->parser_settings.write_error_messages)
+            write_error_message(*m_data, message, argument_id);
         if (m_data->parser_settings.auto_exit)
             exit(m_data->parser_settings.error_exit_code);
         else
             ARGOS_THROW("Error while parsing arguments.");
     }
+
+    const ValueList* ParsedArgumentsImpl::find_values(ValueId value_id) const
+    {
+        auto index = size_t(value_id);
+        return index < m_values.size() ? &m_values[index] : nullptr;
+    }
+
+    ValueList& ParsedArgumentsImpl::values(ValueId value_id)
+    {
+        auto index = size_t(value_id);
+        if (index >= m_values.size())
+            ARGOS_THROW("Invalid value id: " + std::to_string(index));
+        return m_values[index];
+    }
+
+    ParsedArgumentsImpl::Count& ParsedArgumentsImpl::count(ValueId value_id)
+    {
+        // m_counts is never resized after this, the values refer to
+        // the texts in it.
+        if (m_counts.empty())
+            m_counts.resize(m_values.size());
+        return m_counts[size_t(value_id)];
+    }
+
+    void ParsedArgumentsImpl::reset_count(ValueId value_id)
+    {
+        auto index = size_t(value_id);
+        if (index < m_counts.size())
+            m_counts[index].active = false;
+    }
 }
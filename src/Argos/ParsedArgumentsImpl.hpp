@@ -6,9 +6,13 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
-#include <map>
 #include "Argos/IArgumentView.hpp"
+#include "Argos/ParsedArguments.hpp"
+#include "Argos/ValueHandle.hpp"
 #include "ParserData.hpp"
+#include "ResponseFiles.hpp"
+#include "StringStore.hpp"
+#include "ValueList.hpp"
 
 namespace argos
 {
@@ -17,26 +21,69 @@ namespace argos
     class ParsedArgumentsImpl
     {
     public:
-        explicit ParsedArgumentsImpl(std::shared_ptr<ParserData> data);
+        explicit ParsedArgumentsImpl(std::shared_ptr<const ParserData> data);
 
         [[nodiscard]] bool has(ValueId value_id) const;
 
         [[nodiscard]] const std::vector<std::string>& unprocessed_arguments() const;
 
-        void add_unprocessed_argument(const std::string& arg);
+        void add_unprocessed_argument(std::string_view arg);
+
+        std::string_view store_string(std::string_view str);
+
+        std::string_view store_argument(std::string_view arg);
+
+        void set_response_files(std::unique_ptr<ResponseFiles> files);
+
+        // Copies command_line and replaces the contents of args with its
+        // arguments, which are views into the copy. store_argument()
+        // doesn't copy these arguments again.
+        void store_command_line(std::string_view command_line,
+                                std::vector<std::string_view>& args);
+
+        // Removes all values and arguments, but keeps the memory for
+        // the next parse with the same parser data.
+        void clear();
 
         std::string_view assign_value(ValueId value_id,
-                                      const std::string& value,
+                                      std::string_view value,
                                       ArgumentId argument_id);
 
         std::string_view append_value(ValueId value_id,
-                                      const std::string& value,
+                                      std::string_view value,
                                       ArgumentId argument_id);
 
         void clear_value(ValueId value_id);
 
+        // Adds step to the value's count and clamps the result to
+        // [min, max]. The count starts from the current value if it's
+        // an integer, otherwise from 0. Returns the count as text.
+        // Bound values only get an empty marker, like other bound
+        // values, and start from the integer given to set_bound_count.
+        std::string_view count_value(ValueId value_id,
+                                     long long step,
+                                     long long min,
+                                     long long max,
+                                     ArgumentId argument_id,
+                                     bool bound);
+
+        // Makes value the starting point for the next count_value of a
+        // bound value.
+        void set_bound_count(ValueId value_id, long long value);
+
+        // Returns the value's count if its current value was set by
+        // count_value, otherwise nullptr.
+        [[nodiscard]] const long long* find_count(ValueId value_id) const;
+
         [[nodiscard]] ValueId get_value_id(std::string_view value_name) const;
 
+        [[nodiscard]] ValueHandle
+        get_value_handle(std::string_view value_name) const;
+
+        // Returns the handle's value ID, or throws if it isn't valid for
+        // this parser.
+        [[nodiscard]] ValueId get_value_id(ValueHandle handle) const;
+
         [[nodiscard]] std::optional<std::pair<std::string_view, ArgumentId>>
         get_value(ValueId value_id) const;
 
@@ -49,12 +96,24 @@ namespace argos
         [[nodiscard]] std::unique_ptr<IArgumentView>
         get_argument_view(ArgumentId argument_id) const;
 
-        [[nodiscard]] const std::shared_ptr<ParserData>& parser_data() const;
+        [[nodiscard]]
+        const std::shared_ptr<const ParserData>& parser_data() const;
 
         [[nodiscard]] ParserResultCode result_code() const;
 
         void set_result_code(ParserResultCode result_code);
 
+        [[nodiscard]] const std::string& error_message() const;
+
+        void set_error_message(std::string message);
+
+        [[nodiscard]] const SubcommandData* subcommand() const;
+
+        [[nodiscard]] const ParsedArguments& subcommand_arguments() const;
+
+        void set_subcommand(const SubcommandData* subcommand,
+                            ParsedArguments arguments);
+
         [[nodiscard]] const OptionData* stop_option() const;
 
         void set_breaking_option(const OptionData* option);
@@ -65,11 +124,38 @@ namespace argos
         [[noreturn]]
         void error(const std::string& message, ArgumentId argument_id);
     private:
-        std::multimap<ValueId, std::pair<std::string, ArgumentId>> m_values;
-        std::vector<std::tuple<std::string_view, ValueId, ArgumentId>> m_ids;
+        // The text is stored here rather than in m_strings to avoid
+        // adding a new string every time the count changes.
+        struct Count
+        {
+            long long value = 0;
+            bool active = false;
+            // The value is bound to a variable and the value list only
+            // has an empty marker.
+            bool bound = false;
+            char text[24] = {};
+        };
+
+        [[nodiscard]] const ValueList* find_values(ValueId value_id) const;
+
+        ValueList& values(ValueId value_id);
+
+        Count& count(ValueId value_id);
+
+        void reset_count(ValueId value_id);
+
+        std::vector<ValueList> m_values;
+        // Empty unless the parser has COUNT-options.
+        std::vector<Count> m_counts;
+        StringStore m_strings;
         std::vector<std::string> m_unprocessed_arguments;
-        std::shared_ptr<ParserData> m_data;
+        std::shared_ptr<const ParserData> m_data;
         ParserResultCode m_result_code = ParserResultCode::NONE;
         const OptionData* m_stop_option = nullptr;
+        std::string m_error_message;
+        std::unique_ptr<ResponseFiles> m_response_files;
+        std::string m_command_line;
+        const SubcommandData* m_subcommand = nullptr;
+        ParsedArguments m_subcommand_arguments;
     };
 }
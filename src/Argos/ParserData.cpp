@@ -0,0 +1,471 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "ParserData.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include "Argos/Option.hpp"
+#include "ArgosThrow.hpp"
+#include "ConsoleWidth.hpp"
+#include "StringUtilities.hpp"
+
+namespace argos
+{
+    namespace
+    {
+        size_t set_value_ids(const ParserData& data)
+        {
+            struct InternalIdMaker
+            {
+                std::map<std::string_view, ValueId> explicit_ids;
+                ValueId n = ValueId(0);
+
+                std::optional<ValueId> find_value_id(std::string_view name)
+                {
+                    auto it = explicit_ids.find(name);
+                    if (it == explicit_ids.end())
+                        return {};
+                    return it->second;
+                }
+
+                ValueId make_value_id(std::string_view name)
+                {
+                    if (auto id = find_value_id(name))
+                        return *id;
+                    n = ValueId(n + 1);
+                    explicit_ids.emplace(name, n);
+                    return n;
+                }
+
+                ValueId make_value_id(const std::vector<std::string>& names)
+                {
+                    for (const auto& name : names)
+                    {
+                        if (auto id = find_value_id(name))
+                            return *id;
+                    }
+                    n = ValueId(n + 1);
+                    for (const auto& name : names)
+                        explicit_ids.emplace(name, n);
+                    return n;
+                }
+            };
+
+            InternalIdMaker id_maker;
+            for (const auto& a : data.arguments)
+            {
+                if (!a->value.empty())
+                {
+                    a->value_id = id_maker.make_value_id(a->value);
+                    id_maker.explicit_ids.emplace(a->name, a->value_id);
+                }
+                else
+                {
+                    a->value_id = id_maker.make_value_id(a->name);
+                }
+            }
+            for (const auto& o : data.options)
+            {
+                if (o->operation == OptionOperation::NONE)
+                    continue;
+                if (!o->alias.empty())
+                {
+                    o->value_id = id_maker.make_value_id(o->alias);
+                    for (auto& f : o->flags)
+                        id_maker.explicit_ids.emplace(f, o->value_id);
+                }
+                else
+                {
+                    o->value_id = id_maker.make_value_id(o->flags);
+                }
+            }
+            return size_t(id_maker.n);
+        }
+
+        inline bool has_help_option(const ParserData& data)
+        {
+            return std::any_of(data.options.begin(), data.options.end(),
+                               [](const auto& o)
+                               {return o->type == OptionType::HELP;});
+        }
+
+        inline bool has_flag(const ParserData& data, std::string_view flag)
+        {
+            bool ci = data.parser_settings.case_insensitive;
+            return any_of(data.options.begin(), data.options.end(),
+                          [&](const auto& o)
+                          {return any_of(o->flags.begin(), o->flags.end(),
+                                         [&](const auto& f)
+                                         {return are_equal(f, flag, ci);});
+                          });
+        }
+
+        void add_version_option(ParserData& data)
+        {
+            if (data.help_settings.version.empty())
+                return;
+            std::string flag;
+            switch (data.parser_settings.option_style)
+            {
+            case OptionStyle::STANDARD:
+                if (!has_flag(data, "--version"))
+                    flag = "--version";
+                break;
+            case OptionStyle::SLASH:
+                if (!has_flag(data, "/VERSION"))
+                    flag = "/VERSION";
+                break;
+            case OptionStyle::DASH:
+                if (!has_flag(data, "-version"))
+                    flag = "-version";
+                break;
+            }
+
+            if (flag.empty())
+                return;
+
+            auto stream = data.help_settings.output_stream
+                        ? data.help_settings.output_stream
+                        : &std::cout;
+            Option option;
+            option.flag(flag).type(OptionType::STOP)
+                .help("Display the program version.")
+                .constant("1");
+            if (data.parser_settings.write_help_texts)
+            {
+                option.callback([v = data.help_settings.version, stream]
+                                    (auto, auto, auto pa)
+                                {
+                                    *stream << pa.program_name() << " "
+                                            << v << "\n";
+                                    return true;
+                                });
+            }
+            auto opt = option.release();
+            opt->argument_id = ArgumentId(data.options.size()
+                                          + data.arguments.size() + 1);
+            opt->section = data.current_section;
+            data.options.push_back(std::move(opt));
+        }
+
+        OptionTable make_option_table(
+                const std::vector<std::unique_ptr<OptionData>>& options,
+                bool case_insensitive)
+        {
+            OptionTable index;
+            for (auto& option : options)
+            {
+                for (auto& flag : option->flags)
+                    index.emplace_back(flag, option.get());
+            }
+
+            sort(index.begin(), index.end(), [&](const auto& a, const auto& b)
+            {
+                return is_less(a.first, b.first, case_insensitive);
+            });
+
+            auto it = adjacent_find(index.begin(), index.end(),
+                                    [&](const auto& a, const auto& b)
+            {
+                return are_equal(a.first, b.first, case_insensitive);
+            });
+
+            if (it == index.end())
+                return index;
+
+            if (it->first == next(it)->first)
+            {
+                ARGOS_THROW("Multiple definitions of flag "
+                            + std::string(it->first));
+            }
+            else
+            {
+                ARGOS_THROW("Conflicting flags: " + std::string(it->first)
+                            + " and " + std::string(next(it)->first));
+            }
+        }
+
+        // Arguments and options that share a value also share its
+        // binding, which makes it possible to for instance clear a
+        // bound vector with a CLEAR option.
+        std::vector<IValueBinding*> make_value_bindings(const ParserData& data)
+        {
+            std::vector<IValueBinding*> result;
+            auto set_binding = [&](IValueBinding* binding, ValueId value_id,
+                                   const std::string& name)
+            {
+                if (!binding)
+                    return;
+                if (result.empty())
+                    result.resize(data.value_count + 1);
+                auto& b = result[size_t(value_id)];
+                if (b && b != binding)
+                    ARGOS_THROW("The value of " + name
+                                + " is bound to more than one variable.");
+                b = binding;
+            };
+
+            for (const auto& a : data.arguments)
+                set_binding(a->binding.get(), a->value_id, a->name);
+            for (const auto& o : data.options)
+                set_binding(o->binding.get(), o->value_id, o->flags.front());
+            return result;
+        }
+
+        std::vector<bool> make_counted_bound_values(const ParserData& data)
+        {
+            std::vector<bool> result;
+            if (data.value_bindings.empty())
+                return result;
+            for (const auto& o : data.options)
+            {
+                if (o->operation != OptionOperation::COUNT
+                    || !find_value_binding(data, o->value_id))
+                {
+                    continue;
+                }
+                if (result.empty())
+                    result.resize(data.value_count + 1);
+                result[size_t(o->value_id)] = true;
+            }
+            return result;
+        }
+
+        std::vector<const OptionData*>
+        make_typed_value_options(const ParserData& data)
+        {
+            std::vector<const OptionData*> result;
+            for (const auto& o : data.options)
+            {
+                if (o->typed_constant.index() == 0
+                    && o->typed_initial_value.index() == 0)
+                {
+                    continue;
+                }
+                if (result.empty())
+                {
+                    result.resize(data.options.size()
+                                  + data.arguments.size() + 1);
+                }
+                auto index = size_t(o->argument_id);
+                if (index >= result.size())
+                    result.resize(index + 1);
+                result[index] = o.get();
+            }
+            return result;
+        }
+
+        ValueTable make_value_table(const ParserData& data)
+        {
+            ValueTable result;
+            for (auto& a : data.arguments)
+            {
+                result.emplace_back(a->name, a->value_id, a->argument_id);
+                if (!a->value.empty())
+                    result.emplace_back(a->value, a->value_id, a->argument_id);
+            }
+            for (auto& o : data.options)
+            {
+                if (o->operation == OptionOperation::NONE)
+                    continue;
+
+                for (auto& f : o->flags)
+                    result.emplace_back(f, o->value_id, o->argument_id);
+                if (!o->alias.empty())
+                    result.emplace_back(o->alias, o->value_id, o->argument_id);
+            }
+            if (!result.empty())
+            {
+                using std::get;
+                sort(result.begin(), result.end());
+                for (auto it = next(result.begin()); it != result.end(); ++it)
+                {
+                    auto p = prev(it);
+                    if (get<0>(*it) == get<0>(*p) && get<2>(*it) != get<2>(*p))
+                        get<2>(*it) = get<2>(*p) = {};
+                }
+                result.erase(unique(result.begin(), result.end()), result.end());
+            }
+            return result;
+        }
+
+        std::string make_subcommand_key(std::string_view name,
+                                        bool case_insensitive)
+        {
+            std::string key(name);
+            if (case_insensitive)
+            {
+                for (auto& c : key)
+                {
+                    if ('A' <= c && c <= 'Z')
+                        c = char(c + ('a' - 'A'));
+                }
+            }
+            return key;
+        }
+
+        std::unordered_map<std::string, size_t>
+        make_subcommand_index(const ParserData& data)
+        {
+            std::unordered_map<std::string, size_t> result;
+            result.reserve(data.subcommands.size());
+            const auto ci = data.parser_settings.case_insensitive;
+            for (size_t i = 0; i < data.subcommands.size(); ++i)
+            {
+                const auto& name = data.subcommands[i]->name;
+                if (!result.emplace(make_subcommand_key(name, ci), i).second)
+                    ARGOS_THROW("Multiple definitions of subcommand " + name);
+            }
+            return result;
+        }
+
+        bool has_dynamic_texts(const ParserData& data)
+        {
+            for (const auto& [id, text] : data.help_settings.texts)
+            {
+                if (is_dynamic(text))
+                    return true;
+            }
+            for (const auto& a : data.arguments)
+            {
+                if (is_dynamic(a->help))
+                    return true;
+            }
+            for (const auto& o : data.options)
+            {
+                if (is_dynamic(o->help))
+                    return true;
+            }
+            for (const auto& c : data.subcommands)
+            {
+                if (is_dynamic(c->help))
+                    return true;
+            }
+            return false;
+        }
+    }
+
+    void add_missing_help_option(ParserData& data)
+    {
+        if (!data.parser_settings.generate_help_option)
+            return;
+        if (has_help_option(data))
+            return;
+        std::vector<std::string> flags;
+        switch (data.parser_settings.option_style)
+        {
+        case OptionStyle::STANDARD:
+            if (!has_flag(data, "-h"))
+                flags.emplace_back("-h");
+            if (!has_flag(data, "--help"))
+                flags.emplace_back("--help");
+            break;
+        case OptionStyle::SLASH:
+            if (!has_flag(data, "/?"))
+                flags.emplace_back("/?");
+            break;
+        case OptionStyle::DASH:
+            if (!has_flag(data, "-h"))
+                flags.emplace_back("-h");
+            else if (!has_flag(data, "-help"))
+                flags.emplace_back("-help");
+            break;
+        }
+
+        if (flags.empty())
+            return;
+
+        auto opt = Option().flags(std::move(flags)).type(OptionType::HELP)
+            .help("Display the help text.")
+            .constant("1").release();
+        opt->argument_id = ArgumentId(data.options.size()
+                                      + data.arguments.size() + 1);
+        opt->section = data.current_section;
+        data.options.push_back(std::move(opt));
+    }
+
+    void finalize_parser_data(ParserData& data)
+    {
+        if (data.finalized)
+            return;
+
+        add_missing_help_option(data);
+        add_version_option(data);
+        data.value_count = set_value_ids(data);
+        data.flag_index = FlagIndex(
+            make_option_table(data.options,
+                              data.parser_settings.case_insensitive),
+            data.parser_settings.case_insensitive);
+        data.value_table = make_value_table(data);
+        data.value_bindings = make_value_bindings(data);
+        data.counted_bound_values = make_counted_bound_values(data);
+        data.typed_value_options = make_typed_value_options(data);
+        data.subcommand_index = make_subcommand_index(data);
+        data.subcommand_data = std::make_unique<SubcommandDataCache[]>(
+            data.subcommands.size());
+        data.has_dynamic_texts = has_dynamic_texts(data);
+        for (const auto& o : data.options)
+        {
+            if (!o->initial_value.empty())
+                data.initial_value_options.push_back(o.get());
+            if (!o->optional)
+                data.mandatory_options.push_back(o.get());
+        }
+        data.finalized = true;
+    }
+
+    std::optional<size_t> find_subcommand(const ParserData& data,
+                                          std::string_view name)
+    {
+        const auto ci = data.parser_settings.case_insensitive;
+        auto it = data.subcommand_index.find(make_subcommand_key(name, ci));
+        if (it == data.subcommand_index.end())
+            return {};
+        return it->second;
+    }
+
+    ValueId get_value_id(const ParserData& data, std::string_view name)
+    {
+        using std::get;
+        const auto& ids = data.value_table;
+        auto it = std::lower_bound(ids.begin(), ids.end(), name,
+                                   [](auto& p, auto& s)
+                                   {return get<0>(p) < s;});
+        if (it == ids.end() || get<0>(*it) != name)
+            ARGOS_THROW("Unknown value: " + std::string(name));
+        return get<1>(*it);
+    }
+
+    std::string find_argument_name(const ParserData& data,
+                                   ArgumentId argument_id)
+    {
+        for (const auto& a : data.arguments)
+        {
+            if (a->argument_id == argument_id)
+                return a->name;
+        }
+        for (const auto& o : data.options)
+        {
+            if (o->argument_id == argument_id)
+            {
+                std::string name = o->flags.front();
+                for (size_t i = 1; i < o->flags.size(); ++i)
+                    name += ", " + o->flags[i];
+                return name;
+            }
+        }
+        return {};
+    }
+
+    unsigned get_help_text_width(const ParserData& data)
+    {
+        if (data.help_settings.line_width != 0)
+            return data.help_settings.line_width;
+        return get_console_width(32);
+    }
+}
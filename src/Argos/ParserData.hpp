@@ -8,11 +8,16 @@
 #pragma once
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
 #include <variant>
 #include "Argos/Enums.hpp"
 #include "ArgumentData.hpp"
+#include "FlagIndex.hpp"
 #include "OptionData.hpp"
-#include "TextFormatter.hpp"
+#include "SubcommandData.hpp"
 
 #ifndef ARGOS_EX_USAGE
     #ifdef EX_USAGE
@@ -35,6 +40,11 @@ namespace argos
         bool ignore_undefined_arguments = false;
         bool case_insensitive = false;
         bool generate_help_option = true;
+        bool borrow_arguments = false;
+        bool expand_response_files = false;
+        bool write_error_messages = true;
+        // Whether the help and version options write their texts.
+        bool write_help_texts = true;
         int normal_exit_code = 0;
         int error_exit_code = ARGOS_EX_USAGE;
     };
@@ -44,19 +54,146 @@ namespace argos
         std::string program_name;
         std::string version;
         std::map<TextId, TextSource> texts;
+        std::vector<std::string> word_splitting_rules;
         std::ostream* output_stream = nullptr;
+        // 0 means the width of the console.
+        unsigned line_width = 0;
     };
 
+    // The formatted help text for each line width it has been written
+    // with. The map's values stay in place when new widths are added.
+    struct HelpTextCache
+    {
+        std::mutex mutex;
+        std::map<unsigned, std::string> texts;
+    };
+
+    struct ParserData;
+
+    // The finalized parser data of a subcommand, made the first time
+    // the subcommand is used.
+    struct SubcommandDataCache
+    {
+        std::once_flag flag;
+        std::shared_ptr<const ParserData> data;
+    };
+
+    using OptionTable = std::vector<std::pair<std::string_view, const OptionData*>>;
+
+    using ValueTable = std::vector<std::tuple<std::string_view, ValueId, ArgumentId>>;
+
     struct ParserData
     {
         std::vector<std::unique_ptr<ArgumentData>> arguments;
         std::vector<std::unique_ptr<OptionData>> options;
+        std::vector<std::unique_ptr<SubcommandData>> subcommands;
 
         ParserSettings parser_settings;
         HelpSettings help_settings;
 
-        TextFormatter text_formatter;
-
         std::string current_section;
+
+        // Identifies the definition the value IDs are assigned from.
+        // Copies of a definition have the same generation, it changes
+        // when the definition is modified.
+        size_t generation = 0;
+        bool finalized = false;
+        FlagIndex flag_index;
+        ValueTable value_table;
+        size_t value_count = 0;
+        std::vector<const OptionData*> initial_value_options;
+        std::vector<const OptionData*> mandatory_options;
+        // The bindings indexed by value ID. Empty if no arguments or
+        // options are bound to variables.
+        std::vector<IValueBinding*> value_bindings;
+        // Indexed by value ID, true for bound values that are counted by
+        // COUNT-options. Empty if there are no such values.
+        std::vector<bool> counted_bound_values;
+        // The options with typed constants or initial values indexed by
+        // argument ID. Empty if there are no such options.
+        std::vector<const OptionData*> typed_value_options;
+        // Maps subcommand names, folded to lower case if the parser is
+        // case-insensitive, to indexes in subcommands.
+        std::unordered_map<std::string, size_t> subcommand_index;
+        // Indexed like subcommands.
+        mutable std::unique_ptr<SubcommandDataCache[]> subcommand_data;
+        // The help text is only cached if none of its texts come from
+        // dynamic callbacks.
+        bool has_dynamic_texts = false;
+        mutable HelpTextCache help_text_cache;
     };
+
+    void add_missing_help_option(ParserData& data);
+
+    void finalize_parser_data(ParserData& data);
+
+    // Returns the index in data.subcommands of the subcommand named name.
+    std::optional<size_t> find_subcommand(const ParserData& data,
+                                          std::string_view name);
+
+    // Returns the finalized parser data for data.subcommands[index]. The
+    // subcommand's parser gets data's auto_exit, write_error_messages,
+    // write_help_texts and output stream. Implemented in
+    // ArgumentParser.cpp.
+    std::shared_ptr<const ParserData>
+    get_subcommand_data(const ParserData& data, size_t index);
+
+    // Returns the binding for the given value, or nullptr if the value
+    // isn't bound to a variable.
+    inline IValueBinding* find_value_binding(const ParserData& data,
+                                             ValueId value_id)
+    {
+        auto index = size_t(value_id);
+        return index < data.value_bindings.size()
+               ? data.value_bindings[index]
+               : nullptr;
+    }
+
+    inline bool is_counted_bound_value(const ParserData& data,
+                                       ValueId value_id)
+    {
+        auto index = size_t(value_id);
+        return index < data.counted_bound_values.size()
+               && data.counted_bound_values[index];
+    }
+
+    // Returns the typed value if value is the typed constant or initial
+    // value of the option with the given argument ID, otherwise nullptr.
+    inline const TypedValue* find_typed_value(const ParserData& data,
+                                              ArgumentId argument_id,
+                                              std::string_view value)
+    {
+        auto index = size_t(argument_id);
+        if (index >= data.typed_value_options.size())
+            return nullptr;
+        const auto* o = data.typed_value_options[index];
+        if (!o)
+            return nullptr;
+        // The values from constants and initial values refer directly
+        // to the strings in OptionData.
+        if (value.data() == o->constant.data()
+            && value.size() == o->constant.size()
+            && o->typed_constant.index() != 0)
+        {
+            return &o->typed_constant;
+        }
+        if (value.data() == o->initial_value.data()
+            && value.size() == o->initial_value.size()
+            && o->typed_initial_value.index() != 0)
+        {
+            return &o->typed_initial_value;
+        }
+        return nullptr;
+    }
+
+    // Returns the ID of the value of the argument or option named name.
+    // The data must be finalized.
+    ValueId get_value_id(const ParserData& data, std::string_view name);
+
+    // Returns the name of the argument, or the flags of the option, with
+    // the given ID.
+    std::string find_argument_name(const ParserData& data,
+                                   ArgumentId argument_id);
+
+    unsigned get_help_text_width(const ParserData& data);
 }
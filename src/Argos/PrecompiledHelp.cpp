@@ -0,0 +1,68 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Argos/PrecompiledHelp.hpp"
+
+#include "HelpText.hpp"
+
+namespace argos
+{
+    namespace
+    {
+        const PrecompiledHelpText* precompiled_texts = nullptr;
+        size_t precompiled_text_count = 0;
+
+        const PrecompiledHelpText*
+        find_best_width(std::string_view program_name, unsigned line_width)
+        {
+            const PrecompiledHelpText* best = nullptr;
+            for (size_t i = 0; i < precompiled_text_count; ++i)
+            {
+                const auto& text = precompiled_texts[i];
+                if (text.program_name != program_name)
+                    continue;
+                // Use the widest text that fits, or the narrowest text
+                // if none of them fit.
+                if (!best
+                    || (best->line_width > line_width
+                        && text.line_width < best->line_width)
+                    || (best->line_width < text.line_width
+                        && text.line_width <= line_width))
+                {
+                    best = &text;
+                }
+            }
+            return best;
+        }
+    }
+
+    bool set_precompiled_help_texts(const PrecompiledHelpText* texts,
+                                    size_t count)
+    {
+        precompiled_texts = texts;
+        precompiled_text_count = count;
+        return true;
+    }
+
+    const PrecompiledHelpText*
+    find_precompiled_help_text(std::string_view program_name,
+                               unsigned line_width)
+    {
+        if (auto text = find_best_width(program_name, line_width))
+            return text;
+
+        // The main parser's name comes from argv[0], and the executable
+        // may have been renamed after the texts were generated.
+        if (precompiled_text_count != 0
+            && program_name.find(' ') == std::string_view::npos)
+        {
+            return find_best_width(precompiled_texts[0].program_name,
+                                   line_width);
+        }
+        return nullptr;
+    }
+}
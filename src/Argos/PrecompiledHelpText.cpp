@@ -0,0 +1,88 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+
+// Replaces HelpText.cpp in the ArgosPrecompiledHelp library.
+#ifdef ARGOS_PRECOMPILED_HELP
+
+#include "HelpText.hpp"
+
+#include <iostream>
+#include "ArgosThrow.hpp"
+
+namespace argos
+{
+    namespace
+    {
+        const PrecompiledHelpText* find_text(const ParserData& data,
+                                             unsigned line_width)
+        {
+            return find_precompiled_help_text(data.help_settings.program_name,
+                                              line_width);
+        }
+
+        void write(std::ostream& stream, std::string_view text)
+        {
+            stream.write(text.data(), std::streamsize(text.size()));
+        }
+    }
+
+    std::string format_help_text(const ParserData& data, unsigned line_width)
+    {
+        if (const auto* text = find_text(data, line_width))
+            return std::string(text->help_text);
+        return {};
+    }
+
+    std::string format_error_usage(const ParserData& data,
+                                   unsigned line_width)
+    {
+        if (const auto* text = find_text(data, line_width))
+            return std::string(text->error_usage);
+        return {};
+    }
+
+    void write_help_text(const ParserData& data)
+    {
+        auto* stream = data.help_settings.output_stream;
+        if (!stream)
+            stream = &std::cout;
+        if (const auto* text = find_text(data, get_help_text_width(data)))
+            write(*stream, text->help_text);
+    }
+
+    void write_error_message(const ParserData& data, const std::string& msg)
+    {
+        auto* stream = data.help_settings.output_stream;
+        if (!stream)
+            stream = &std::cerr;
+        // Without the formatter, the message isn't split into lines.
+        auto text = data.help_settings.program_name + ": " + msg + "\n";
+        if (const auto* t = find_text(data, get_help_text_width(data)))
+            text += t->error_usage;
+        write(*stream, text);
+    }
+
+    void write_error_message(const ParserData& data, const std::string& msg,
+                             ArgumentId argument_id)
+    {
+        if (auto name = find_argument_name(data, argument_id); !name.empty())
+            write_error_message(data, name + ": " + msg);
+        else
+            write_error_message(data, msg);
+    }
+
+    void write_precompiled_help_header(const std::vector<const ParserData*>&,
+                                       const std::vector<unsigned>&,
+                                       std::ostream&)
+    {
+        ARGOS_THROW("Programs linked with ArgosPrecompiledHelp can't"
+                    " generate help texts.");
+    }
+}
+
+#endif
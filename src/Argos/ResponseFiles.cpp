@@ -0,0 +1,256 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "ResponseFiles.hpp"
+
+#include <cstring>
+#include <functional>
+#include "CommandLineTokenizer.hpp"
+
+#if defined(__APPLE__) || defined(unix) || defined(__unix) || defined(__unix__)
+    #define ARGOS_POSIX_FILES
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#else
+    #include <fstream>
+    #include <iterator>
+#endif
+
+namespace argos
+{
+    // The contents of a single response file. Regular files are mapped
+    // copy-on-write, which means that only the pages where the tokenizer
+    // removes quotes or escapes are ever copied.
+    class ResponseFile
+    {
+    public:
+        ResponseFile() = default;
+
+        ResponseFile(const ResponseFile&) = delete;
+
+        ~ResponseFile()
+        {
+#ifdef ARGOS_POSIX_FILES
+            if (m_mapped)
+                munmap(m_data, m_size);
+#endif
+        }
+
+        ResponseFile& operator=(const ResponseFile&) = delete;
+
+        static std::unique_ptr<ResponseFile> open(const std::string& path);
+
+        [[nodiscard]] char* data() const
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] bool is_same_file(const ResponseFile& other) const
+        {
+#ifdef ARGOS_POSIX_FILES
+            return m_device == other.m_device && m_inode == other.m_inode;
+#else
+            return m_path == other.m_path;
+#endif
+        }
+
+        [[nodiscard]] bool contains(std::string_view str) const
+        {
+            std::less_equal<const char*> less_equal;
+            return less_equal(m_data, str.data())
+                   && less_equal(str.data() + str.size(), m_data + m_size);
+        }
+    private:
+        char* m_data = nullptr;
+        size_t m_size = 0;
+        std::string m_buffer;
+#ifdef ARGOS_POSIX_FILES
+        bool m_mapped = false;
+        dev_t m_device = 0;
+        ino_t m_inode = 0;
+#else
+        std::string m_path;
+#endif
+    };
+
+#ifdef ARGOS_POSIX_FILES
+
+    std::unique_ptr<ResponseFile> ResponseFile::open(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return {};
+
+        struct stat st = {};
+        if (fstat(fd, &st) == -1 || S_ISDIR(st.st_mode))
+        {
+            close(fd);
+            return {};
+        }
+
+        auto file = std::make_unique<ResponseFile>();
+        file->m_device = st.st_dev;
+        file->m_inode = st.st_ino;
+        if (S_ISREG(st.st_mode) && st.st_size > 0)
+        {
+            auto size = size_t(st.st_size);
+            void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                file->m_data = static_cast<char*>(data);
+                file->m_size = size;
+                file->m_mapped = true;
+                close(fd);
+                return file;
+            }
+        }
+
+        // Pipes and other files that can't be mapped are read into memory.
+        char buffer[4096];
+        ssize_t n;
+        while ((n = read(fd, buffer, sizeof(buffer))) > 0)
+            file->m_buffer.append(buffer, size_t(n));
+        close(fd);
+        if (n == -1)
+            return {};
+        file->m_data = file->m_buffer.data();
+        file->m_size = file->m_buffer.size();
+        return file;
+    }
+
+#else
+
+    std::unique_ptr<ResponseFile> ResponseFile::open(const std::string& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+            return {};
+
+        auto file = std::make_unique<ResponseFile>();
+        file->m_path = path;
+        file->m_buffer.assign(std::istreambuf_iterator<char>(stream),
+                              std::istreambuf_iterator<char>());
+        file->m_data = file->m_buffer.data();
+        file->m_size = file->m_buffer.size();
+        return file;
+    }
+
+#endif
+
+    namespace
+    {
+        void split_on_nul(char* text, size_t size,
+                          std::vector<std::string_view>& result)
+        {
+            const char* end = text + size;
+            const char* it = text;
+            while (it != end)
+            {
+                auto nul = static_cast<const char*>(
+                    std::memchr(it, '\0', size_t(end - it)));
+                if (!nul)
+                    nul = end;
+                result.emplace_back(it, size_t(nul - it));
+                it = nul == end ? end : nul + 1;
+            }
+        }
+    }
+
+    std::vector<std::string_view> tokenize_response_file(char* text,
+                                                         size_t size)
+    {
+        std::vector<std::string_view> result;
+        if (std::memchr(text, '\0', size))
+            split_on_nul(text, size, result);
+        else
+            tokenize_command_line(text, size, result);
+        return result;
+    }
+
+    ResponseFiles::ResponseFiles() = default;
+
+    ResponseFiles::~ResponseFiles() = default;
+
+    std::vector<std::string_view>
+    ResponseFiles::expand(const std::vector<std::string_view>& args)
+    {
+        std::vector<std::string_view> result;
+        result.reserve(args.size());
+        if (!expand(args, result))
+            return {};
+        return result;
+    }
+
+    const std::string& ResponseFiles::error() const
+    {
+        return m_error;
+    }
+
+    bool ResponseFiles::empty() const
+    {
+        return m_files.empty();
+    }
+
+    bool ResponseFiles::contains(std::string_view str) const
+    {
+        for (const auto& file : m_files)
+        {
+            if (file->contains(str))
+                return true;
+        }
+        return false;
+    }
+
+    bool ResponseFiles::expand(const std::vector<std::string_view>& args,
+                               std::vector<std::string_view>& result)
+    {
+        for (auto arg : args)
+        {
+            if (arg.size() < 2 || arg[0] != '@')
+            {
+                result.push_back(arg);
+                continue;
+            }
+
+            // Like GCC, arguments that don't refer to a readable file
+            // are kept as they are.
+            std::string path(arg.substr(1));
+            auto file = ResponseFile::open(path);
+            if (!file)
+            {
+                result.push_back(arg);
+                continue;
+            }
+
+            for (const auto* open_file : m_open_files)
+            {
+                if (open_file->is_same_file(*file))
+                {
+                    m_error = "Response file includes itself: " + path;
+                    return false;
+                }
+            }
+
+            auto tokens = tokenize_response_file(file->data(), file->size());
+            m_open_files.push_back(file.get());
+            m_files.push_back(std::move(file));
+            auto success = expand(tokens, result);
+            m_open_files.pop_back();
+            if (!success)
+                return false;
+        }
+        return true;
+    }
+}
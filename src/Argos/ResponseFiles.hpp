@@ -0,0 +1,58 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace argos
+{
+    class ResponseFile;
+
+    // Replaces arguments of the form @path with the arguments in the file
+    // at path. The files are memory-mapped where possible and tokenized in
+    // place, the expanded arguments are views into the files and remain
+    // valid for the life time of the ResponseFiles instance.
+    class ResponseFiles
+    {
+    public:
+        ResponseFiles();
+
+        ResponseFiles(const ResponseFiles&) = delete;
+
+        ~ResponseFiles();
+
+        ResponseFiles& operator=(const ResponseFiles&) = delete;
+
+        // Returns an empty vector and sets error() if a response file
+        // refers to itself, directly or indirectly.
+        std::vector<std::string_view>
+        expand(const std::vector<std::string_view>& args);
+
+        [[nodiscard]] const std::string& error() const;
+
+        [[nodiscard]] bool empty() const;
+
+        // Returns true if str is a view into one of the response files.
+        [[nodiscard]] bool contains(std::string_view str) const;
+    private:
+        bool expand(const std::vector<std::string_view>& args,
+                    std::vector<std::string_view>& result);
+
+        std::vector<std::unique_ptr<ResponseFile>> m_files;
+        std::vector<const ResponseFile*> m_open_files;
+        std::string m_error;
+    };
+
+    // Splits text into arguments with tokenize_command_line(). If text
+    // contains NUL characters, it's split on those instead and the text
+    // is returned verbatim.
+    std::vector<std::string_view> tokenize_response_file(char* text,
+                                                         size_t size);
+}
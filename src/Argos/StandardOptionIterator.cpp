@@ -21,13 +21,13 @@ namespace argos
           m_pos(0)
     {}
 
-    StandardOptionIterator::StandardOptionIterator(const StandardOptionIterator& rhs)
-        : m_args(rhs.m_args),
-          m_args_it(m_args.begin() + std::distance(rhs.m_args.begin(), rhs.m_args_it)),
-          m_pos(rhs.m_pos)
+    StandardOptionIterator::StandardOptionIterator(
+            std::unique_ptr<IArgumentSource> source)
+        : m_args_it(m_args.end()),
+          m_source(std::move(source))
     {}
 
-    std::optional<std::string> StandardOptionIterator::next()
+    std::optional<std::string_view> StandardOptionIterator::next()
     {
         if (m_pos == std::string_view::npos)
         {
@@ -38,60 +38,61 @@ namespace argos
         {
             if (m_pos < m_args_it->size() && (*m_args_it)[1] != '-')
             {
-                auto c = (*m_args_it)[m_pos++];
+                m_short_flag[1] = (*m_args_it)[m_pos++];
                 if (m_pos == m_args_it->size())
                     m_pos = std::string_view::npos;
-                return std::string{'-', c};
+                return std::string_view(m_short_flag, 2);
             }
             ++m_args_it;
             m_pos = 0;
         }
 
-        if (m_args_it == m_args.end())
+        if (at_end())
             return {};
 
         if (m_args_it->size() <= 2 || (*m_args_it)[0] != '-')
         {
             m_pos = std::string_view::npos;
-            return std::string(*m_args_it);
+            return *m_args_it;
         }
 
         if ((*m_args_it)[1] != '-')
         {
             m_pos = 2;
-            return std::string(m_args_it->substr(0, 2));
+            return m_args_it->substr(0, 2);
         }
 
         auto eq = m_args_it->find('=');
         if (eq == std::string_view::npos)
         {
             m_pos = std::string_view::npos;
-            return std::string(*m_args_it);
+            return *m_args_it;
         }
 
         m_pos = eq + 1;
-        return std::string(m_args_it->substr(0, m_pos));
+        return m_args_it->substr(0, m_pos);
     }
 
-    std::optional<std::string> StandardOptionIterator::next_value()
+    std::optional<std::string_view> StandardOptionIterator::next_value()
     {
-        if (m_args_it == m_args.end())
+        if (at_end())
             return {};
 
         if (m_pos != std::string_view::npos)
         {
             auto result = m_args_it->substr(m_pos);
             m_pos = std::string_view::npos;
-            return std::string(result);
+            return result;
         }
 
-        if (++m_args_it == m_args.end())
+        ++m_args_it;
+        if (at_end())
         {
             m_pos = 0;
             return {};
         }
 
-        return std::string(*m_args_it);
+        return *m_args_it;
     }
 
     std::string_view StandardOptionIterator::current() const
@@ -101,14 +102,46 @@ namespace argos
         return *m_args_it;
     }
 
-    std::vector<std::string_view> StandardOptionIterator::remaining_arguments() const
+    std::vector<std::string_view> StandardOptionIterator::remaining_arguments()
+    {
+        if (m_pos != 0 && m_args_it != m_args.end())
+        {
+            ++m_args_it;
+            m_pos = 0;
+        }
+        if (at_end())
+            return {};
+        std::vector<std::string_view> result(m_args_it, m_args.cend());
+        m_args_it = m_args.end();
+        return result;
+    }
+
+    void StandardOptionIterator::reset(std::vector<std::string_view>& args)
     {
-        auto it = m_pos == 0 ? m_args_it : std::next(m_args_it);
-        return std::vector<std::string_view>(it, m_args.end());
+        m_args.swap(args);
+        m_args_it = m_args.begin();
+        m_pos = 0;
+        m_source.reset();
+        m_end_of_source = false;
     }
 
-    IOptionIterator* StandardOptionIterator::clone() const
+    bool StandardOptionIterator::at_end()
     {
-        return new StandardOptionIterator(*this);
+        while (m_args_it == m_args.end())
+        {
+            // The source is kept after it runs dry, the final batch may
+            // still be referenced.
+            if (!m_source || m_end_of_source)
+                return true;
+            if (!m_source->next_batch(m_args))
+            {
+                m_end_of_source = true;
+                m_args.clear();
+                m_args_it = m_args.end();
+                return true;
+            }
+            m_args_it = m_args.begin();
+        }
+        return false;
     }
 }
@@ -0,0 +1,67 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "StringStore.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace argos
+{
+    namespace
+    {
+        constexpr size_t MIN_BLOCK_SIZE = 256;
+        constexpr size_t MAX_BLOCK_SIZE = 64 * 1024;
+    }
+
+    std::string_view StringStore::add(std::string_view str)
+    {
+        if (str.empty())
+            return {};
+        auto* ptr = allocate(str.size());
+        std::memcpy(ptr, str.data(), str.size());
+        return {ptr, str.size()};
+    }
+
+    void StringStore::clear()
+    {
+        if (m_blocks.empty())
+            return;
+        m_blocks.erase(m_blocks.begin(), m_blocks.end() - 1);
+        m_next = m_blocks.back().get();
+        m_remaining = m_block_size;
+    }
+
+    char* StringStore::allocate(size_t size)
+    {
+        if (size <= m_remaining)
+        {
+            auto* result = m_next;
+            m_next += size;
+            m_remaining -= size;
+            return result;
+        }
+
+        // Strings that are large compared to the current block size
+        // get a block of their own, the current block remains in use.
+        if (size > m_block_size / 4 && m_block_size != 0)
+        {
+            std::unique_ptr<char[]> block(new char[size]);
+            auto* result = block.get();
+            m_blocks.insert(m_blocks.end() - 1, std::move(block));
+            return result;
+        }
+
+        m_block_size = std::clamp(m_block_size * 2, MIN_BLOCK_SIZE,
+                                  MAX_BLOCK_SIZE);
+        auto block_size = std::max(m_block_size, size);
+        m_blocks.emplace_back(new char[block_size]);
+        m_next = m_blocks.back().get() + size;
+        m_remaining = block_size - size;
+        return m_blocks.back().get();
+    }
+}
@@ -0,0 +1,43 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace argos
+{
+    // Blocks are never moved or reallocated, the string_views returned
+    // by add() remain valid for the life time of the store.
+    class StringStore
+    {
+    public:
+        StringStore() = default;
+
+        StringStore(const StringStore&) = delete;
+
+        StringStore(StringStore&&) noexcept = default;
+
+        StringStore& operator=(const StringStore&) = delete;
+
+        StringStore& operator=(StringStore&&) noexcept = default;
+
+        std::string_view add(std::string_view str);
+
+        // Invalidates all strings in the store. The most recent, and
+        // largest, block is kept for the strings that are added next.
+        void clear();
+    private:
+        char* allocate(size_t size);
+
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        char* m_next = nullptr;
+        size_t m_remaining = 0;
+        size_t m_block_size = 0;
+    };
+}
@@ -9,6 +9,8 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include "Utf8Scanner.hpp"
 
 namespace argos
 {
@@ -138,21 +140,49 @@ namespace argos
         return 0;
     }
 
+    namespace
+    {
+        // Returns true if the eight bytes starting at str[i] are ASCII.
+        bool are_ascii8(std::string_view str, size_t i)
+        {
+            if (str.size() - i < 8)
+                return false;
+            uint64_t bytes;
+            std::memcpy(&bytes, str.data() + i, 8);
+            return (bytes & 0x8080808080808080u) == 0;
+        }
+    }
+
     size_t count_code_points(std::string_view str)
     {
-        size_t count = 0;
+        Utf8ScanState state;
         size_t char_len = 0;
-        for (auto c : str)
+        // Most words in a help text are shorter than a block, the extra
+        // bookkeeping only pays off for longer strings.
+        const bool is_long = str.size() >= UTF8_SCAN_BLOCK_SIZE;
+        if (is_long)
+        {
+            scan_utf8_blocks(str, SIZE_MAX, state);
+            char_len = count_bits(state.pending);
+        }
+        size_t count = state.count;
+        for (size_t i = state.index; i < str.size(); ++i)
         {
             if (char_len == 0)
             {
-                char_len = get_code_point_length(c);
+                if (is_long && are_ascii8(str, i))
+                {
+                    count += 8;
+                    i += 7;
+                    continue;
+                }
+                char_len = get_code_point_length(str[i]);
                 if (char_len == 0)
                     return str.size();
                 ++count;
                 --char_len;
             }
-            else if ((unsigned(static_cast<uint8_t>(c)) & 0xC0u) == 0x80u)
+            else if ((unsigned(static_cast<uint8_t>(str[i])) & 0xC0u) == 0x80u)
             {
                 --char_len;
             }
@@ -168,14 +198,26 @@ namespace argos
     {
         if (n >= str.size())
             return std::string_view::npos;
-        size_t count = 0;
+        Utf8ScanState state;
         size_t char_len = 0;
-        for (size_t i = 0; i < str.size(); ++i)
+        if (str.size() >= UTF8_SCAN_BLOCK_SIZE)
+        {
+            scan_utf8_blocks(str, n, state);
+            char_len = count_bits(state.pending);
+        }
+        size_t count = state.count;
+        for (size_t i = state.index; i < str.size(); ++i)
         {
             if (char_len == 0)
             {
                 if (count == n)
                     return i;
+                if (n - count >= 8 && are_ascii8(str, i))
+                {
+                    count += 8;
+                    i += 7;
+                    continue;
+                }
                 char_len = get_code_point_length(str[i]);
                 if (char_len == 0)
                     return n;
@@ -0,0 +1,112 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Argos/Subcommand.hpp"
+
+#include "ArgosThrow.hpp"
+#include "SubcommandData.hpp"
+
+namespace argos
+{
+    Subcommand::Subcommand()
+        : m_subcommand(std::make_unique<SubcommandData>())
+    {}
+
+    Subcommand::Subcommand(const std::string& name,
+                           SubcommandFactory factory)
+        : m_subcommand(std::make_unique<SubcommandData>())
+    {
+        m_subcommand->name = name;
+        m_subcommand->factory = std::move(factory);
+    }
+
+    Subcommand::Subcommand(const Subcommand& rhs)
+        : m_subcommand(rhs.m_subcommand
+                       ? std::make_unique<SubcommandData>(*rhs.m_subcommand)
+                       : std::unique_ptr<SubcommandData>())
+    {}
+
+    Subcommand::Subcommand(Subcommand&& rhs) noexcept
+        : m_subcommand(std::move(rhs.m_subcommand))
+    {}
+
+    Subcommand::~Subcommand() = default;
+
+    Subcommand& Subcommand::operator=(const Subcommand& rhs)
+    {
+        if (this != &rhs)
+        {
+            if (rhs.m_subcommand)
+                m_subcommand = std::make_unique<SubcommandData>(*rhs.m_subcommand);
+            else
+                m_subcommand = {};
+        }
+        return *this;
+    }
+
+    Subcommand& Subcommand::operator=(Subcommand&& rhs) noexcept
+    {
+        m_subcommand = std::move(rhs.m_subcommand);
+        return *this;
+    }
+
+    Subcommand& Subcommand::help(const std::string& text)
+    {
+        check_subcommand();
+        m_subcommand->help = text;
+        return *this;
+    }
+
+    Subcommand& Subcommand::help(TextCallback callback,
+                                 TextCallbackMode mode)
+    {
+        check_subcommand();
+        m_subcommand->help = make_text_source(std::move(callback), mode);
+        return *this;
+    }
+
+    Subcommand& Subcommand::section(const std::string& name)
+    {
+        check_subcommand();
+        m_subcommand->section = name;
+        return *this;
+    }
+
+    Subcommand& Subcommand::visibility(Visibility visibility)
+    {
+        check_subcommand();
+        m_subcommand->visibility = visibility;
+        return *this;
+    }
+
+    Subcommand& Subcommand::name(const std::string& name)
+    {
+        check_subcommand();
+        m_subcommand->name = name;
+        return *this;
+    }
+
+    Subcommand& Subcommand::factory(SubcommandFactory factory)
+    {
+        check_subcommand();
+        m_subcommand->factory = std::move(factory);
+        return *this;
+    }
+
+    std::unique_ptr<SubcommandData> Subcommand::release()
+    {
+        check_subcommand();
+        return std::move(m_subcommand);
+    }
+
+    void Subcommand::check_subcommand() const
+    {
+        if (!m_subcommand)
+            ARGOS_THROW("Cannot use Subcommand instance after"
+                        " release() has been called.");
+    }
+}
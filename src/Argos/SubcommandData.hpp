@@ -0,0 +1,24 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <string>
+#include "Argos/Enums.hpp"
+#include "Argos/Subcommand.hpp"
+#include "TextSource.hpp"
+
+namespace argos
+{
+    struct SubcommandData
+    {
+        std::string name;
+        TextSource help;
+        std::string section;
+        SubcommandFactory factory;
+        Visibility visibility = Visibility::NORMAL;
+    };
+}
@@ -8,10 +8,31 @@
 #pragma once
 #include <variant>
 #include "Argos/Callbacks.hpp"
+#include "Argos/Enums.hpp"
 
 namespace argos
 {
-    using TextSource = std::variant <std::string, TextCallback>;
+    // A callback that has been marked with TextCallbackMode::CACHEABLE.
+    struct CacheableTextCallback
+    {
+        TextCallback callback;
+    };
+
+    using TextSource = std::variant <std::string, TextCallback,
+                                     CacheableTextCallback>;
+
+    inline TextSource make_text_source(TextCallback callback,
+                                       TextCallbackMode mode)
+    {
+        if (mode == TextCallbackMode::CACHEABLE)
+            return CacheableTextCallback{std::move(callback)};
+        return callback;
+    }
+
+    inline bool is_dynamic(const TextSource& source)
+    {
+        return std::holds_alternative<TextCallback>(source);
+    }
 
     inline std::string get_text(const TextSource& source)
     {
@@ -26,6 +47,11 @@ namespace argos
             {
                 return f();
             }
+
+            std::string operator()(const CacheableTextCallback& c)
+            {
+                return c.callback();
+            }
         };
         return std::visit(Visitor(), source);
     }
@@ -0,0 +1,196 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Utf8Scanner.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) \
+    || (defined(__i386__) && defined(__SSE2__)) \
+    || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define ARGOS_X86_SIMD
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+        #define ARGOS_TARGET_AVX2
+    #else
+        #define ARGOS_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace argos
+{
+    unsigned count_bits(uint32_t bits)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return unsigned(__builtin_popcount(bits));
+#else
+        bits = bits - ((bits >> 1) & 0x55555555u);
+        bits = (bits & 0x33333333u) + ((bits >> 2) & 0x33333333u);
+        bits = (bits + (bits >> 4)) & 0x0F0F0F0Fu;
+        return (bits * 0x01010101u) >> 24;
+#endif
+    }
+
+#ifdef ARGOS_X86_SIMD
+
+    namespace
+    {
+        // Bit masks where bit i tells something about byte i in a block.
+        struct ByteClasses
+        {
+            // Bytes 0x80 to 0xFF.
+            uint32_t non_ascii;
+            // Bytes 0x80 to 0xBF.
+            uint32_t continuation;
+            // Bytes 0xE0 to 0xFF.
+            uint32_t three_or_more;
+            // Bytes 0xF0 to 0xFF.
+            uint32_t four_or_more;
+            // Bytes 0xF8 to 0xFF, these are never valid.
+            uint32_t invalid;
+        };
+
+        // Applies the block's byte classes to state. Returns false, and
+        // leaves state unchanged, if the block isn't valid UTF-8 or
+        // contains more code points than max_count allows.
+        bool advance(const ByteClasses& classes, unsigned block_size,
+                     size_t max_count, Utf8ScanState& state)
+        {
+            // Valid UTF-8 has continuation bytes where, and only where,
+            // the preceding lead bytes require them.
+            uint32_t continuation = 0;
+            uint64_t expected = state.pending;
+            if (classes.non_ascii)
+            {
+                if (classes.invalid)
+                    return false;
+                continuation = classes.continuation;
+                const uint64_t lead = classes.non_ascii & ~continuation;
+                expected |= (lead << 1)
+                            | (uint64_t(classes.three_or_more) << 2)
+                            | (uint64_t(classes.four_or_more) << 3);
+            }
+
+            const auto block_mask = (uint64_t(1) << block_size) - 1;
+            if ((expected & block_mask) != continuation)
+                return false;
+
+            const auto count = state.count + block_size
+                               - count_bits(continuation);
+            if (count > max_count)
+                return false;
+
+            state.index += block_size;
+            state.count = count;
+            state.pending = uint32_t(expected >> block_size);
+            return true;
+        }
+
+        void scan_utf8_blocks_sse2(std::string_view str, size_t max_count,
+                                   Utf8ScanState& state)
+        {
+            // The comparisons are signed, bytes 0x80 to 0xFF are
+            // negative.
+            const auto c0 = _mm_set1_epi8(char(0xC0));
+            const auto df = _mm_set1_epi8(char(0xDF));
+            const auto ef = _mm_set1_epi8(char(0xEF));
+            const auto f7 = _mm_set1_epi8(char(0xF7));
+            while (str.size() - state.index >= 16)
+            {
+                auto bytes = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(str.data() + state.index));
+                ByteClasses classes = {};
+                classes.non_ascii = uint32_t(_mm_movemask_epi8(bytes));
+                if (classes.non_ascii)
+                {
+                    classes.continuation = uint32_t(_mm_movemask_epi8(
+                        _mm_cmplt_epi8(bytes, c0)));
+                    classes.three_or_more = uint32_t(_mm_movemask_epi8(
+                        _mm_cmpgt_epi8(bytes, df))) & classes.non_ascii;
+                    classes.four_or_more = uint32_t(_mm_movemask_epi8(
+                        _mm_cmpgt_epi8(bytes, ef))) & classes.non_ascii;
+                    classes.invalid = uint32_t(_mm_movemask_epi8(
+                        _mm_cmpgt_epi8(bytes, f7))) & classes.non_ascii;
+                }
+                if (!advance(classes, 16, max_count, state))
+                    break;
+            }
+        }
+
+        ARGOS_TARGET_AVX2
+        void scan_utf8_blocks_avx2(std::string_view str, size_t max_count,
+                                   Utf8ScanState& state)
+        {
+            const auto c0 = _mm256_set1_epi8(char(0xC0));
+            const auto df = _mm256_set1_epi8(char(0xDF));
+            const auto ef = _mm256_set1_epi8(char(0xEF));
+            const auto f7 = _mm256_set1_epi8(char(0xF7));
+            while (str.size() - state.index >= 32)
+            {
+                auto bytes = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(str.data() + state.index));
+                ByteClasses classes = {};
+                classes.non_ascii = uint32_t(_mm256_movemask_epi8(bytes));
+                if (classes.non_ascii)
+                {
+                    classes.continuation = uint32_t(_mm256_movemask_epi8(
+                        _mm256_cmpgt_epi8(c0, bytes)));
+                    classes.three_or_more = uint32_t(_mm256_movemask_epi8(
+                        _mm256_cmpgt_epi8(bytes, df))) & classes.non_ascii;
+                    classes.four_or_more = uint32_t(_mm256_movemask_epi8(
+                        _mm256_cmpgt_epi8(bytes, ef))) & classes.non_ascii;
+                    classes.invalid = uint32_t(_mm256_movemask_epi8(
+                        _mm256_cmpgt_epi8(bytes, f7))) & classes.non_ascii;
+                }
+                if (!advance(classes, 32, max_count, state))
+                    break;
+            }
+            // The SSE2 version handles a remaining block of 16 bytes.
+            scan_utf8_blocks_sse2(str, max_count, state);
+        }
+
+        bool has_avx2()
+        {
+#ifdef _MSC_VER
+            int info[4];
+            __cpuid(info, 1);
+            const bool has_osxsave = (info[2] & (1 << 27)) != 0;
+            const bool has_avx = (info[2] & (1 << 28)) != 0;
+            // The OS must save the AVX registers on context switches.
+            if (!has_osxsave || !has_avx || (_xgetbv(0) & 6) != 6)
+                return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+
+        using ScanFunction = void (*)(std::string_view, size_t,
+                                      Utf8ScanState&);
+
+        ScanFunction select_scan_function()
+        {
+            return has_avx2() ? scan_utf8_blocks_avx2 : scan_utf8_blocks_sse2;
+        }
+    }
+
+    void scan_utf8_blocks(std::string_view str, size_t max_count,
+                          Utf8ScanState& state)
+    {
+        if (str.size() - state.index < UTF8_SCAN_BLOCK_SIZE)
+            return;
+        static const ScanFunction scan = select_scan_function();
+        scan(str, max_count, state);
+    }
+
+#else
+
+    void scan_utf8_blocks(std::string_view, size_t, Utf8ScanState&)
+    {}
+
+#endif
+}
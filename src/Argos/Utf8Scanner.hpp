@@ -0,0 +1,39 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace argos
+{
+    // The smallest number of bytes scan_utf8_blocks processes.
+    constexpr size_t UTF8_SCAN_BLOCK_SIZE = 16;
+
+    struct Utf8ScanState
+    {
+        // The index of the next byte.
+        size_t index = 0;
+        // The number of code points that start before index.
+        size_t count = 0;
+        // Bit i is set if the byte at index + i must be a continuation
+        // byte.
+        uint32_t pending = 0;
+    };
+
+    // Advances state over blocks of 16 or 32 bytes at a time with SSE2
+    // or AVX2 instructions, whichever the CPU supports. It stops at the
+    // first block that isn't valid UTF-8, that would make state.count
+    // greater than max_count, or that extends past the end of str. The
+    // caller must process the remaining bytes one at a time.
+    //
+    // Does nothing on other CPUs than x86 and x86-64.
+    void scan_utf8_blocks(std::string_view str, size_t max_count,
+                          Utf8ScanState& state);
+
+    [[nodiscard]] unsigned count_bits(uint32_t bits);
+}
@@ -0,0 +1,280 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Argos/ValueBinding.hpp"
+
+#include "ParseValue.hpp"
+
+namespace argos
+{
+    namespace
+    {
+        template <typename T>
+        std::optional<T> convert(std::string_view str)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+                return !str.empty() && str != "0" && str != "false";
+            else if constexpr (std::is_same_v<T, std::string>)
+                return std::string(str);
+            else if constexpr (std::is_floating_point_v<T>)
+                return parse_floating_point<T>(str);
+            else
+                return parse_integer<T>(str, 10);
+        }
+
+        template <typename T>
+        class ScalarBinding : public IValueBinding
+        {
+        public:
+            explicit ScalarBinding(T* target)
+                : m_target(target)
+            {}
+
+            bool assign(std::string_view value) override
+            {
+                auto v = convert<T>(value);
+                if (!v)
+                    return false;
+                *m_target = std::move(*v);
+                return true;
+            }
+
+            bool append(std::string_view value) override
+            {
+                return assign(value);
+            }
+
+            void clear() override
+            {
+                *m_target = T();
+            }
+        private:
+            T* m_target;
+        };
+
+        template <typename T>
+        class VectorBinding : public IValueBinding
+        {
+        public:
+            explicit VectorBinding(std::vector<T>* target)
+                : m_target(target)
+            {}
+
+            bool assign(std::string_view value) override
+            {
+                auto v = convert<T>(value);
+                if (!v)
+                    return false;
+                m_target->clear();
+                m_target->push_back(std::move(*v));
+                return true;
+            }
+
+            bool append(std::string_view value) override
+            {
+                auto v = convert<T>(value);
+                if (!v)
+                    return false;
+                m_target->push_back(std::move(*v));
+                return true;
+            }
+
+            void clear() override
+            {
+                m_target->clear();
+            }
+        private:
+            std::vector<T>* m_target;
+        };
+
+        template <typename T>
+        std::shared_ptr<IValueBinding> make_binding(T* target)
+        {
+            return std::make_shared<ScalarBinding<T>>(target);
+        }
+
+        template <typename T>
+        std::shared_ptr<IValueBinding> make_binding(std::vector<T>* target)
+        {
+            return std::make_shared<VectorBinding<T>>(target);
+        }
+    }
+
+    namespace
+    {
+        template <typename T>
+        bool parse_value_impl(std::string_view str, T& value)
+        {
+            auto v = convert<T>(str);
+            if (!v)
+                return false;
+            value = std::move(*v);
+            return true;
+        }
+    }
+
+    bool parse_value(std::string_view str, bool& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, int& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, unsigned& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, long& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, unsigned long& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, long long& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, unsigned long long& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, float& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, double& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    bool parse_value(std::string_view str, std::string& value)
+    {
+        return parse_value_impl(str, value);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(bool* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(int* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(unsigned* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(long* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(unsigned long* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(long long* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(unsigned long long* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(float* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(double* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding> make_value_binding(std::string* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<bool>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<int>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<unsigned>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<long>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<unsigned long>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<long long>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<unsigned long long>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<float>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<double>* target)
+    {
+        return make_binding(target);
+    }
+
+    std::shared_ptr<IValueBinding>
+    make_value_binding(std::vector<std::string>* target)
+    {
+        return make_binding(target);
+    }
+}
@@ -0,0 +1,73 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <string_view>
+#include <vector>
+#include "Argos/Enums.hpp"
+
+namespace argos
+{
+    // Most values are only assigned once, the first value is therefore
+    // stored inline and m_values is only used when there are more.
+    class ValueList
+    {
+    public:
+        using Value = std::pair<std::string_view, ArgumentId>;
+
+        [[nodiscard]] bool empty() const
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]] size_t size() const
+        {
+            return m_values.capacity() == 0 ? m_size : m_values.size();
+        }
+
+        [[nodiscard]] const Value* begin() const
+        {
+            return m_values.capacity() == 0 ? &m_value : m_values.data();
+        }
+
+        [[nodiscard]] const Value* end() const
+        {
+            return begin() + size();
+        }
+
+        [[nodiscard]] const Value& front() const
+        {
+            return *begin();
+        }
+
+        void push_back(const Value& value)
+        {
+            if (m_values.capacity() == 0)
+            {
+                if (m_size == 0)
+                {
+                    m_value = value;
+                    m_size = 1;
+                    return;
+                }
+                m_values.reserve(4);
+                m_values.push_back(m_value);
+            }
+            m_values.push_back(value);
+        }
+
+        void clear()
+        {
+            m_values.clear();
+            m_size = 0;
+        }
+    private:
+        Value m_value;
+        size_t m_size = 0;
+        std::vector<Value> m_values;
+    };
+}
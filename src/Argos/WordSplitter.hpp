@@ -6,7 +6,6 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
-#include <list>
 #include <map>
 #include <string>
 #include <string_view>
@@ -31,7 +30,6 @@ namespace argos
             unsigned index;
             char separator;
         };
-        std::map<std::string_view, std::vector<Split>> m_splits;
-        std::list<std::string> m_strings;
+        std::map<std::string, std::vector<Split>, std::less<>> m_splits;
     };
 }
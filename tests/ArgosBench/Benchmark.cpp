@@ -0,0 +1,141 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Benchmark.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> allocation_count(0);
+    std::atomic<uint64_t> allocated_bytes(0);
+
+    void* allocate(size_t size)
+    {
+        allocation_count.fetch_add(1, std::memory_order_relaxed);
+        allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+        if (auto* p = std::malloc(size ? size : 1))
+            return p;
+        throw std::bad_alloc();
+    }
+}
+
+// Counts the allocations, and the number of bytes allocated, made by the
+// benchmarks.
+void* operator new(size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace argos_bench
+{
+    const void* volatile sink = nullptr;
+
+    namespace
+    {
+        double min_time = 0.5;
+    }
+
+    Benchmark::Benchmark(std::string name)
+    {
+        m_result.name = std::move(name);
+    }
+
+    void Benchmark::run(const std::function<void()>& func)
+    {
+        using Clock = std::chrono::steady_clock;
+        // Warm up caches and lazily initialized data.
+        func();
+
+        uint64_t iterations = 1;
+        while (true)
+        {
+            auto allocations = allocation_count.load();
+            auto bytes = allocated_bytes.load();
+            auto start = Clock::now();
+            for (uint64_t i = 0; i < iterations; ++i)
+                func();
+            std::chrono::duration<double> elapsed = Clock::now() - start;
+            if (elapsed.count() >= min_time || iterations >= (1u << 30))
+            {
+                allocations = allocation_count.load() - allocations;
+                bytes = allocated_bytes.load() - bytes;
+                m_result.iterations = iterations;
+                m_result.ns_per_op = elapsed.count() * 1e9
+                                     / double(iterations);
+                m_result.allocations_per_op = double(allocations)
+                                              / double(iterations);
+                m_result.bytes_per_op = double(bytes) / double(iterations);
+                return;
+            }
+            // Aim slightly above the minimum time to avoid a final round
+            // that is just short of it.
+            auto factor = elapsed.count() > 0
+                          ? 1.2 * min_time / elapsed.count()
+                          : 10.0;
+            if (factor > 10)
+                factor = 10;
+            iterations = uint64_t(double(iterations) * factor) + 1;
+        }
+    }
+
+    void Benchmark::set_rate(std::string unit, uint64_t items_per_op)
+    {
+        m_result.rate_unit = std::move(unit);
+        m_result.items_per_op = items_per_op;
+    }
+
+    const BenchmarkResult& Benchmark::result() const
+    {
+        return m_result;
+    }
+
+    BenchmarkRegistrar::BenchmarkRegistrar(const char* name,
+                                           BenchmarkFunction func)
+    {
+        benchmarks().emplace_back(name, func);
+    }
+
+    std::vector<std::pair<std::string, BenchmarkFunction>>& benchmarks()
+    {
+        static std::vector<std::pair<std::string, BenchmarkFunction>> list;
+        return list;
+    }
+
+    void set_min_time(double seconds)
+    {
+        min_time = seconds;
+    }
+}
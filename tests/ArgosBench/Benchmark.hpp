@@ -0,0 +1,82 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace argos_bench
+{
+    struct BenchmarkResult
+    {
+        std::string name;
+        uint64_t iterations = 0;
+        double ns_per_op = 0;
+        double allocations_per_op = 0;
+        double bytes_per_op = 0;
+        // Set with Benchmark::set_rate, reported as items per second.
+        std::string rate_unit;
+        uint64_t items_per_op = 0;
+    };
+
+    class Benchmark
+    {
+    public:
+        explicit Benchmark(std::string name);
+
+        /**
+         * Calls @a func repeatedly until the minimum measuring time has
+         * passed and records the average time per call. Setup code
+         * belongs outside @a func.
+         */
+        void run(const std::function<void()>& func);
+
+        /**
+         * Reports the throughput as @a unit per second in addition to
+         * the time per call, for instance lines per second when each
+         * call processes @a items_per_op lines.
+         */
+        void set_rate(std::string unit, uint64_t items_per_op);
+
+        [[nodiscard]] const BenchmarkResult& result() const;
+    private:
+        BenchmarkResult m_result;
+    };
+
+    using BenchmarkFunction = void (*)(Benchmark&);
+
+    struct BenchmarkRegistrar
+    {
+        BenchmarkRegistrar(const char* name, BenchmarkFunction func);
+    };
+
+    std::vector<std::pair<std::string, BenchmarkFunction>>& benchmarks();
+
+    void set_min_time(double seconds);
+
+    extern const void* volatile sink;
+
+    template <typename T>
+    void do_not_optimize(const T& value)
+    {
+        sink = &value;
+    }
+}
+
+#define ARGOS_BENCH_CONCAT2(a, b) a##b
+#define ARGOS_BENCH_CONCAT(a, b) ARGOS_BENCH_CONCAT2(a, b)
+
+#define ARGOS_BENCHMARK(name) \
+    static void ARGOS_BENCH_CONCAT(argos_bench_, __LINE__)( \
+        ::argos_bench::Benchmark&); \
+    static ::argos_bench::BenchmarkRegistrar \
+        ARGOS_BENCH_CONCAT(argos_bench_registrar_, __LINE__)( \
+            name, ARGOS_BENCH_CONCAT(argos_bench_, __LINE__)); \
+    static void ARGOS_BENCH_CONCAT(argos_bench_, __LINE__)( \
+        ::argos_bench::Benchmark& bench)
@@ -0,0 +1,104 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <climits>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+#ifdef _WIN32
+    #include <io.h>
+    #include <fcntl.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr size_t FILE_COUNT = 500000;
+
+    std::string make_file_names(size_t count)
+    {
+        std::string result;
+        for (size_t i = 0; i < count; ++i)
+        {
+            result += "./src/module" + std::to_string(i % 97)
+                      + "/file" + std::to_string(i) + ".cpp";
+            result += '\0';
+        }
+        return result;
+    }
+
+    argos::ArgumentParser make_parser()
+    {
+        using namespace argos;
+        return ArgumentParser("bench")
+            .auto_exit(false)
+            .add(Argument("FILE").count(1, UINT_MAX))
+            .add(Option{"-v", "--verbose"})
+            .move();
+    }
+
+    size_t iterate(argos::ArgumentIterator& iterator)
+    {
+        std::unique_ptr<argos::IArgumentView> arg;
+        std::string_view value;
+        size_t count = 0;
+        while (iterator.next(arg, value))
+            ++count;
+        return count;
+    }
+}
+
+ARGOS_BENCHMARK("ArgumentSource/500k/vector")
+{
+    const auto parser = make_parser();
+    auto names = make_file_names(FILE_COUNT);
+    std::vector<std::string_view> args;
+    for (size_t pos = 0; pos < names.size();)
+    {
+        auto end = names.find('\0', pos);
+        args.emplace_back(names.data() + pos, end - pos);
+        pos = end + 1;
+    }
+    bench.run([&]
+    {
+        auto iterator = parser.make_iterator(args);
+        auto n = iterate(iterator);
+        argos_bench::do_not_optimize(n);
+    });
+}
+
+ARGOS_BENCHMARK("ArgumentSource/500k/delimited_file")
+{
+    auto path = (std::filesystem::temp_directory_path()
+                 / "argos_bench_source.txt").string();
+    std::ofstream(path, std::ios::binary) << make_file_names(FILE_COUNT);
+
+    const auto parser = make_parser();
+    bench.run([&]
+    {
+#ifdef _WIN32
+        auto fd = _open(path.c_str(), _O_RDONLY | _O_BINARY);
+#else
+        auto fd = open(path.c_str(), O_RDONLY);
+#endif
+        auto iterator = parser.make_iterator(
+            std::make_unique<argos::DelimitedArgumentSource>(fd));
+        auto n = iterate(iterator);
+        argos_bench::do_not_optimize(n);
+#ifdef _WIN32
+        _close(fd);
+#else
+        close(fd);
+#endif
+    });
+    std::remove(path.c_str());
+}
@@ -0,0 +1,102 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    constexpr size_t LINE_COUNT = 1024;
+
+    // Lines of the kind a REPL or a server receives, some with quotes
+    // and escapes.
+    std::vector<std::string> make_lines()
+    {
+        std::vector<std::string> result;
+        result.reserve(LINE_COUNT);
+        for (size_t i = 0; i < LINE_COUNT; ++i)
+        {
+            auto n = std::to_string(i);
+            switch (i % 4)
+            {
+            case 0:
+                result.push_back("get --verbose --count " + n + " key" + n);
+                break;
+            case 1:
+                result.push_back("set --name 'value number " + n
+                                 + "' key" + n);
+                break;
+            case 2:
+                result.push_back("set --name=\"a \\\"quoted\\\" value\" key"
+                                 + n + " key" + n + "b");
+                break;
+            default:
+                result.push_back("del -v key\\ " + n);
+                break;
+            }
+        }
+        return result;
+    }
+
+    argos::ArgumentParser make_parser()
+    {
+        using namespace argos;
+        return ArgumentParser("repl")
+            .auto_exit(false)
+            .add(Argument("COMMAND"))
+            .add(Argument("KEY").count(1, 10))
+            .add(Option{"-v", "--verbose"})
+            .add(Option{"-c", "--count"}.argument("N"))
+            .add(Option{"-n", "--name"}.argument("NAME"))
+            .move();
+    }
+}
+
+ARGOS_BENCHMARK("CommandLine/1k lines/parse_command_line")
+{
+    const auto parser = make_parser();
+    const auto lines = make_lines();
+    bench.set_rate("lines", LINE_COUNT);
+    bench.run([&]
+    {
+        for (const auto& line : lines)
+        {
+            auto result = parser.parse_command_line(line);
+            argos_bench::do_not_optimize(result);
+        }
+    });
+}
+
+ARGOS_BENCHMARK("CommandLine/1k lines/pre-split parse")
+{
+    // The same arguments, split in advance, for comparison.
+    const auto parser = make_parser();
+    std::vector<std::vector<std::string>> split_lines;
+    for (const auto& line : make_lines())
+    {
+        auto args = parser.parse_command_line(line);
+        std::vector<std::string> split{args.value("COMMAND").as_string()};
+        if (args.value("--verbose").as_bool())
+            split.emplace_back("-v");
+        if (auto count = args.value("--count"))
+            split.insert(split.end(), {"-c", count.as_string()});
+        if (auto name = args.value("--name"))
+            split.insert(split.end(), {"-n", name.as_string()});
+        for (const auto& key : args.values("KEY").as_strings())
+            split.push_back(key);
+        split_lines.push_back(std::move(split));
+    }
+    bench.set_rate("lines", LINE_COUNT);
+    bench.run([&]
+    {
+        for (const auto& line : split_lines)
+        {
+            auto result = parser.parse({line.begin(), line.end()});
+            argos_bench::do_not_optimize(result);
+        }
+    });
+}
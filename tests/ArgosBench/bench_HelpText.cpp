@@ -0,0 +1,81 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <sstream>
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    argos::ArgumentParser make_parser(std::ostream& stream,
+                                      argos::TextCallbackMode mode,
+                                      unsigned line_width = 80)
+    {
+        using namespace argos;
+        ArgumentParser parser("bench");
+        parser.auto_exit(false)
+            .line_width(line_width)
+            .stream(&stream)
+            .about("A program with many options. The text in this"
+                   " paragraph is long enough to be split over"
+                   " several lines.");
+        for (int i = 0; i < 50; ++i)
+        {
+            auto n = std::to_string(i);
+            parser.add(Option{"--option-" + n, "--set-" + n}.argument("VALUE")
+                           .help([n]
+                           {
+                               return "Sets the value of option " + n
+                                      + ". The value is used by the"
+                                        " program in some way.";
+                           }, mode));
+        }
+        parser.add(Argument("FILE").count(0, 100)
+                       .help("The files to process."));
+        return parser;
+    }
+
+    void write_help(argos_bench::Benchmark& bench,
+                    argos::TextCallbackMode mode,
+                    unsigned line_width = 80)
+    {
+        std::ostringstream ss;
+        const auto parser = make_parser(ss, mode, line_width);
+        bench.run([&]
+        {
+            ss.str({});
+            parser.write_help_text();
+        });
+    }
+}
+
+ARGOS_BENCHMARK("HelpText/50_options/cacheable")
+{
+    write_help(bench, argos::TextCallbackMode::CACHEABLE);
+}
+
+ARGOS_BENCHMARK("HelpText/50_options/dynamic")
+{
+    write_help(bench, argos::TextCallbackMode::DYNAMIC);
+}
+
+// Dynamic texts are formatted every time, which makes these measure
+// the text formatting.
+ARGOS_BENCHMARK("HelpText/50_options/width_40")
+{
+    write_help(bench, argos::TextCallbackMode::DYNAMIC, 40);
+}
+
+ARGOS_BENCHMARK("HelpText/50_options/width_120")
+{
+    write_help(bench, argos::TextCallbackMode::DYNAMIC, 120);
+}
+
+ARGOS_BENCHMARK("HelpText/50_options/width_200")
+{
+    write_help(bench, argos::TextCallbackMode::DYNAMIC, 200);
+}
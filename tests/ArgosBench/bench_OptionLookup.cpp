@@ -0,0 +1,107 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    const char* const WORDS[] = {
+        "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf",
+        "hotel", "india", "juliett", "kilo", "lima", "mike", "november",
+        "oscar", "papa", "quebec", "romeo", "sierra", "tango"
+    };
+
+    // The words give 400 different flags, larger parsers get a numeric
+    // prefix that keeps the abbreviated flags unambiguous.
+    std::string make_flag(size_t i)
+    {
+        std::string prefix = i < 400 ? "" : std::to_string(i / 400) + "-";
+        return "--" + prefix + WORDS[i % 20] + "-"
+               + WORDS[(i / 20) % 20] + "-option";
+    }
+
+    argos::ArgumentParser make_parser(size_t option_count,
+                                      bool case_insensitive,
+                                      bool abbreviations)
+    {
+        using namespace argos;
+        ArgumentParser parser("bench");
+        parser.auto_exit(false)
+            .case_insensitive(case_insensitive)
+            .allow_abbreviated_options(abbreviations);
+        for (size_t i = 0; i < option_count; ++i)
+            parser.add(Option{make_flag(i)});
+        return parser;
+    }
+
+    void parse_options(argos_bench::Benchmark& bench, size_t option_count,
+                       bool case_insensitive, bool abbreviations)
+    {
+        const auto parser = make_parser(option_count, case_insensitive,
+                                        abbreviations);
+        std::vector<std::string> strings;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            auto flag = make_flag((i * 7919) % option_count);
+            if (abbreviations)
+                flag.resize(flag.size() - 5);
+            if (case_insensitive)
+            {
+                auto pos = flag.find_first_not_of("-0123456789") + 1;
+                flag[pos] = char(flag[pos] - 'a' + 'A');
+            }
+            strings.push_back(flag);
+        }
+        std::vector<std::string_view> args(strings.begin(), strings.end());
+        bench.run([&]
+        {
+            auto result = parser.parse(args);
+            argos_bench::do_not_optimize(result);
+        });
+    }
+}
+
+ARGOS_BENCHMARK("OptionLookup/exact/10")
+{
+    parse_options(bench, 10, false, false);
+}
+
+ARGOS_BENCHMARK("OptionLookup/exact/400")
+{
+    parse_options(bench, 400, false, false);
+}
+
+ARGOS_BENCHMARK("OptionLookup/case_insensitive/400")
+{
+    parse_options(bench, 400, true, false);
+}
+
+ARGOS_BENCHMARK("OptionLookup/abbreviated/400")
+{
+    parse_options(bench, 400, false, true);
+}
+
+ARGOS_BENCHMARK("OptionLookup/abbreviated_case_insensitive/400")
+{
+    parse_options(bench, 400, true, true);
+}
+
+ARGOS_BENCHMARK("OptionLookup/exact/1000")
+{
+    parse_options(bench, 1000, false, false);
+}
+
+ARGOS_BENCHMARK("OptionLookup/case_insensitive/1000")
+{
+    parse_options(bench, 1000, true, false);
+}
+
+ARGOS_BENCHMARK("OptionLookup/abbreviated/1000")
+{
+    parse_options(bench, 1000, false, true);
+}
@@ -0,0 +1,155 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <climits>
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    argos::ArgumentParser make_parser()
+    {
+        using namespace argos;
+        return ArgumentParser("bench")
+            .auto_exit(false)
+            .add(Argument("FILE").count(0, UINT_MAX))
+            .add(Option{"-v", "--verbose"})
+            .add(Option{"-o", "--output"}.argument("FILE"))
+            .add(Option{"-I", "--include"}.argument("DIR")
+                     .operation(OptionOperation::APPEND))
+            .add(Option{"-j", "--jobs"}.argument("N"))
+            .add(Option{"--"}.type(OptionType::LAST_OPTION))
+            .move();
+    }
+
+    // A mix of flags, options with arguments and plain arguments.
+    std::vector<std::string> make_tokens(size_t count)
+    {
+        std::vector<std::string> result;
+        result.reserve(count);
+        while (result.size() < count)
+        {
+            auto n = std::to_string(result.size());
+            switch (result.size() % 5)
+            {
+            case 0:
+                result.push_back("-v");
+                break;
+            case 1:
+                result.push_back("--include=include/dir" + n);
+                break;
+            case 2:
+                result.push_back("-j" + n);
+                break;
+            default:
+                result.push_back("src/file" + n + ".cpp");
+                break;
+            }
+        }
+        return result;
+    }
+
+    void parse_tokens(argos_bench::Benchmark& bench, size_t count)
+    {
+        const auto parser = make_parser();
+        auto tokens = make_tokens(count);
+        std::vector<std::string_view> args(tokens.begin(), tokens.end());
+        bench.set_rate("tokens", count);
+        bench.run([&]
+        {
+            auto result = parser.parse(args);
+            argos_bench::do_not_optimize(result);
+        });
+    }
+
+    // Includes the cost of defining and finalizing the parser, which
+    // is paid every time a program starts.
+    void define_and_parse(argos_bench::Benchmark& bench, size_t option_count)
+    {
+        std::vector<std::string> flags;
+        for (size_t i = 0; i < option_count; ++i)
+            flags.push_back("--option-" + std::to_string(i));
+        std::vector<std::string_view> args;
+        for (size_t i = 0; i < 10; ++i)
+            args.emplace_back(flags[(i * 7919) % option_count]);
+        bench.run([&]
+        {
+            using namespace argos;
+            ArgumentParser parser("bench");
+            parser.auto_exit(false);
+            for (const auto& flag : flags)
+                parser.add(Option{flag}.help("Sets an option."));
+            auto result = parser.parse(args);
+            argos_bench::do_not_optimize(result);
+        });
+    }
+
+    // Counts 5000 repetitions of a flag, either with a COUNT option or
+    // the traditional way with an APPEND option and values().size().
+    void count_flags(argos_bench::Benchmark& bench,
+                     argos::OptionOperation operation)
+    {
+        using namespace argos;
+        auto option = Option{"-v"}.operation(operation);
+        if (operation == OptionOperation::APPEND)
+            option.constant(1);
+        const auto parser = ArgumentParser("bench")
+            .auto_exit(false)
+            .add(std::move(option))
+            .move();
+        std::vector<std::string_view> args(5000, "-v");
+        bench.set_rate("tokens", args.size());
+        bench.run([&]
+        {
+            auto result = parser.parse(args);
+            int count = operation == OptionOperation::COUNT
+                        ? result.value("-v").as_int()
+                        : int(result.values("-v").size());
+            argos_bench::do_not_optimize(count);
+        });
+    }
+}
+
+ARGOS_BENCHMARK("Parse/tokens/10")
+{
+    parse_tokens(bench, 10);
+}
+
+ARGOS_BENCHMARK("Parse/tokens/1k")
+{
+    parse_tokens(bench, 1000);
+}
+
+ARGOS_BENCHMARK("Parse/tokens/1M")
+{
+    parse_tokens(bench, 1000000);
+}
+
+ARGOS_BENCHMARK("Parse/define_and_parse/10_options")
+{
+    define_and_parse(bench, 10);
+}
+
+ARGOS_BENCHMARK("Parse/define_and_parse/100_options")
+{
+    define_and_parse(bench, 100);
+}
+
+ARGOS_BENCHMARK("Parse/define_and_parse/1000_options")
+{
+    define_and_parse(bench, 1000);
+}
+
+ARGOS_BENCHMARK("Parse/count_flags/append")
+{
+    count_flags(bench, argos::OptionOperation::APPEND);
+}
+
+ARGOS_BENCHMARK("Parse/count_flags/count")
+{
+    count_flags(bench, argos::OptionOperation::COUNT);
+}
@@ -0,0 +1,65 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <thread>
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    void parse_batch(argos_bench::Benchmark& bench, unsigned thread_count)
+    {
+        using namespace argos;
+        ArgumentParser parser("bench");
+        parser.auto_exit(false)
+            .add(Option({"-n", "--number"}).argument("N"))
+            .add(Option({"-v", "--verbose"}).operation(OptionOperation::APPEND)
+                     .constant(1))
+            .add(Option({"--name"}).argument("NAME"))
+            .add(Argument("FILE").count(1, 100));
+        const auto& const_parser = parser;
+
+        std::vector<std::string> strings;
+        for (int i = 0; i < 100; ++i)
+            strings.push_back("file" + std::to_string(i) + ".txt");
+        std::vector<std::vector<std::string_view>> command_lines(10000);
+        for (size_t i = 0; i < command_lines.size(); ++i)
+        {
+            auto& args = command_lines[i];
+            args = {"-vv", "--number", "42", "--name=batch"};
+            for (size_t j = 0; j < 5 + i % 20; ++j)
+                args.push_back(strings[(i + j) % strings.size()]);
+        }
+
+        bench.run([&]
+        {
+            auto result = const_parser.parse_batch(command_lines,
+                                                   thread_count);
+            argos_bench::do_not_optimize(result);
+        });
+    }
+}
+
+ARGOS_BENCHMARK("ParseBatch/10k/1_thread")
+{
+    parse_batch(bench, 1);
+}
+
+ARGOS_BENCHMARK("ParseBatch/10k/2_threads")
+{
+    parse_batch(bench, 2);
+}
+
+ARGOS_BENCHMARK("ParseBatch/10k/4_threads")
+{
+    parse_batch(bench, 4);
+}
+
+ARGOS_BENCHMARK("ParseBatch/10k/all_threads")
+{
+    parse_batch(bench, 0);
+}
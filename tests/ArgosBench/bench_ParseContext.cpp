@@ -0,0 +1,87 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    argos::ArgumentParser make_parser(bool borrow_arguments)
+    {
+        using namespace argos;
+        return ArgumentParser("server")
+            .auto_exit(false)
+            .borrow_arguments(borrow_arguments)
+            .add(Argument("COMMAND"))
+            .add(Argument("KEY").count(1, 10))
+            .add(Option{"-v", "--verbose"})
+            .add(Option{"-c", "--count"}.argument("N"))
+            .add(Option{"-n", "--name"}.argument("NAME"))
+            .add(Option{"-t", "--tag"}.argument("TAG")
+                     .operation(OptionOperation::APPEND))
+            .move();
+    }
+
+    const std::vector<std::string_view> ARGS = {
+        "set", "--verbose", "--count=12", "--name", "a name",
+        "-t", "tag1", "-t", "tag2", "key1", "key2"};
+
+    void parse(argos_bench::Benchmark& bench, bool borrow_arguments)
+    {
+        const auto parser = make_parser(borrow_arguments);
+        bench.run([&]
+        {
+            auto result = parser.parse(ARGS);
+            argos_bench::do_not_optimize(result);
+        });
+    }
+
+    void parse_with_context(argos_bench::Benchmark& bench,
+                            bool borrow_arguments)
+    {
+        const auto parser = make_parser(borrow_arguments);
+        argos::ParseContext context;
+        bench.run([&]
+        {
+            auto result = parser.parse(ARGS, context);
+            argos_bench::do_not_optimize(result);
+        });
+    }
+}
+
+ARGOS_BENCHMARK("ParseContext/11 args/parse")
+{
+    parse(bench, false);
+}
+
+ARGOS_BENCHMARK("ParseContext/11 args/parse with context")
+{
+    parse_with_context(bench, false);
+}
+
+ARGOS_BENCHMARK("ParseContext/11 args/borrowed/parse")
+{
+    parse(bench, true);
+}
+
+ARGOS_BENCHMARK("ParseContext/11 args/borrowed/parse with context")
+{
+    parse_with_context(bench, true);
+}
+
+ARGOS_BENCHMARK("ParseContext/command line/parse with context")
+{
+    const auto parser = make_parser(false);
+    argos::ParseContext context;
+    bench.run([&]
+    {
+        auto result = parser.parse_command_line(
+            "set --verbose --count=12 --name 'a name' -t tag1 -t tag2"
+            " key1 key2", context);
+        argos_bench::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,244 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <climits>
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    std::vector<std::string> make_file_names(size_t count)
+    {
+        std::vector<std::string> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            result.push_back("./src/module" + std::to_string(i % 97)
+                             + "/file" + std::to_string(i) + ".cpp");
+        return result;
+    }
+
+    void copy_files(argos_bench::Benchmark& bench, size_t count)
+    {
+        using namespace argos;
+        const auto parser = ArgumentParser("bench")
+            .auto_exit(false)
+            .add(Argument("FILE").count(1, UINT_MAX))
+            .add(Argument("DEST"))
+            .add(Option{"-v", "--verbose"})
+            .move();
+        auto files = make_file_names(count);
+        std::vector<std::string_view> args(files.begin(), files.end());
+        bench.run([&]
+        {
+            auto result = parser.parse(args);
+            auto n = result.values("FILE").size();
+            argos_bench::do_not_optimize(n);
+        });
+    }
+
+    void parse_files(argos_bench::Benchmark& bench, size_t count,
+                     bool borrow_arguments = false)
+    {
+        using namespace argos;
+        const auto parser = ArgumentParser("bench")
+            .auto_exit(false)
+            .borrow_arguments(borrow_arguments)
+            .add(Argument("FILE").count(1, UINT_MAX))
+            .move();
+        auto files = make_file_names(count);
+        std::vector<std::string_view> args(files.begin(), files.end());
+        bench.run([&]
+        {
+            auto result = parser.parse(args);
+            auto n = result.values("FILE").size();
+            argos_bench::do_not_optimize(n);
+        });
+    }
+
+    void values_as_ints(argos_bench::Benchmark& bench, size_t count)
+    {
+        using namespace argos;
+        const auto parser = ArgumentParser("bench")
+            .auto_exit(false)
+            .add(Option{"-n"}.argument("N")
+                     .operation(OptionOperation::APPEND))
+            .move();
+        std::vector<std::string> strings;
+        for (size_t i = 0; i < count; ++i)
+            strings.push_back("-n" + std::to_string(i * 37));
+        std::vector<std::string_view> args(strings.begin(), strings.end());
+        auto result = parser.parse(args);
+        bench.set_rate("values", count);
+        bench.run([&]
+        {
+            auto ints = result.values("-n").as_ints();
+            argos_bench::do_not_optimize(ints);
+        });
+    }
+
+    // A request handler that reads 40 options for each request.
+    argos::ArgumentParser make_request_parser(std::vector<std::string>& flags)
+    {
+        using namespace argos;
+        ArgumentParser parser("bench");
+        parser.auto_exit(false);
+        for (int i = 0; i < 40; ++i)
+        {
+            flags.push_back("--request-option-" + std::to_string(i));
+            parser.add(Option{flags.back()}.argument("VALUE"));
+        }
+        return parser;
+    }
+
+    std::vector<std::string_view>
+    make_request_args(const std::vector<std::string>& flags)
+    {
+        std::vector<std::string_view> args;
+        for (size_t i = 0; i < flags.size(); i += 2)
+        {
+            args.emplace_back(flags[i]);
+            args.emplace_back("value");
+        }
+        return args;
+    }
+}
+
+ARGOS_BENCHMARK("ParsedArguments/40_options/value_by_name")
+{
+    std::vector<std::string> flags;
+    const auto parser = make_request_parser(flags);
+    auto args = parser.parse(make_request_args(flags));
+    size_t n = 0;
+    bench.run([&]
+    {
+        for (const auto& flag : flags)
+            n += args.value(flag).as_string().size();
+        argos_bench::do_not_optimize(n);
+    });
+}
+
+ARGOS_BENCHMARK("ParsedArguments/40_options/value_by_handle")
+{
+    std::vector<std::string> flags;
+    const auto parser = make_request_parser(flags);
+    std::vector<argos::ValueHandle> handles;
+    for (const auto& flag : flags)
+        handles.push_back(parser.value_handle(flag));
+    auto args = parser.parse(make_request_args(flags));
+    size_t n = 0;
+    bench.run([&]
+    {
+        for (auto handle : handles)
+            n += args.value(handle).as_string().size();
+        argos_bench::do_not_optimize(n);
+    });
+}
+
+ARGOS_BENCHMARK("ParsedArguments/40_options/parse_then_as_int")
+{
+    std::vector<std::string> flags;
+    const auto parser = make_request_parser(flags);
+    std::vector<argos::ValueHandle> handles;
+    std::vector<std::string_view> args;
+    for (const auto& flag : flags)
+    {
+        handles.push_back(parser.value_handle(flag));
+        args.emplace_back(flag);
+        args.emplace_back("12345");
+    }
+    std::vector<int> values(flags.size());
+    bench.run([&]
+    {
+        auto result = parser.parse(args);
+        for (size_t i = 0; i < handles.size(); ++i)
+            values[i] = result.value(handles[i]).as_int();
+        argos_bench::do_not_optimize(values);
+    });
+}
+
+ARGOS_BENCHMARK("ParsedArguments/40_options/parse_bound")
+{
+    using namespace argos;
+    std::vector<int> values(40);
+    ArgumentParser parser("bench");
+    parser.auto_exit(false);
+    std::vector<std::string> flags;
+    std::vector<std::string_view> args;
+    for (int i = 0; i < 40; ++i)
+        flags.push_back("--request-option-" + std::to_string(i));
+    for (int i = 0; i < 40; ++i)
+    {
+        parser.add(Option{flags[i]}.argument("VALUE").bind(&values[i]));
+        args.emplace_back(flags[i]);
+        args.emplace_back("12345");
+    }
+    const auto& const_parser = parser;
+    bench.run([&]
+    {
+        auto result = const_parser.parse(args);
+        argos_bench::do_not_optimize(result);
+    });
+}
+
+// Reads 20 boolean switches and 20 integer constants that have already
+// been parsed, as in services that check feature flags on hot paths.
+ARGOS_BENCHMARK("ParsedArguments/feature_flags/read")
+{
+    using namespace argos;
+    ArgumentParser parser("bench");
+    parser.auto_exit(false);
+    std::vector<std::string> flags;
+    for (int i = 0; i < 40; ++i)
+        flags.push_back("--feature-" + std::to_string(i));
+    for (int i = 0; i < 40; ++i)
+    {
+        if (i % 2 == 0)
+            parser.add(Option{flags[i]});
+        else
+            parser.add(Option{flags[i]}.constant(1000 * i));
+    }
+    const auto& const_parser = parser;
+    std::vector<ValueHandle> handles;
+    for (const auto& flag : flags)
+        handles.push_back(const_parser.value_handle(flag));
+    auto result = const_parser.parse({flags.begin(), flags.end()});
+    long long sum = 0;
+    bench.run([&]
+    {
+        for (size_t i = 0; i < handles.size(); i += 2)
+        {
+            sum += result.value(handles[i]).as_bool();
+            sum += result.value(handles[i + 1]).as_llong();
+        }
+    });
+    argos_bench::do_not_optimize(sum);
+}
+
+ARGOS_BENCHMARK("ParsedArguments/files/1k")
+{
+    parse_files(bench, 1000);
+}
+
+ARGOS_BENCHMARK("ParsedArguments/files/500k")
+{
+    parse_files(bench, 500000);
+}
+
+ARGOS_BENCHMARK("ParsedArguments/files/500k/borrowed")
+{
+    parse_files(bench, 500000, true);
+}
+
+ARGOS_BENCHMARK("ParsedArguments/files_dest/500k")
+{
+    copy_files(bench, 500000);
+}
+
+ARGOS_BENCHMARK("ParsedArguments/values_as_ints/100k")
+{
+    values_as_ints(bench, 100000);
+}
@@ -0,0 +1,94 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <climits>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    constexpr size_t FILE_COUNT = 200000;
+
+    std::vector<std::string> make_file_names(size_t count)
+    {
+        std::vector<std::string> result;
+        result.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            result.push_back("./src/module" + std::to_string(i % 97)
+                             + "/file" + std::to_string(i) + ".cpp");
+        return result;
+    }
+
+    argos::ArgumentParser make_parser(bool borrow_arguments)
+    {
+        using namespace argos;
+        return ArgumentParser("bench")
+            .auto_exit(false)
+            .borrow_arguments(borrow_arguments)
+            .expand_response_files(true)
+            .add(Argument("FILE").count(1, UINT_MAX))
+            .move();
+    }
+
+    void parse_argv(argos_bench::Benchmark& bench, bool borrow_arguments)
+    {
+        const auto parser = make_parser(borrow_arguments);
+        auto files = make_file_names(FILE_COUNT);
+        std::vector<std::string_view> args(files.begin(), files.end());
+        bench.run([&]
+        {
+            auto result = parser.parse(args);
+            auto n = result.values("FILE").size();
+            argos_bench::do_not_optimize(n);
+        });
+    }
+
+    void parse_response_file(argos_bench::Benchmark& bench, char separator)
+    {
+        auto path = (std::filesystem::temp_directory_path()
+                     / "argos_bench_files.rsp").string();
+        {
+            std::ofstream file(path, std::ios::binary);
+            for (const auto& name : make_file_names(FILE_COUNT))
+                file << name << separator;
+        }
+
+        const auto parser = make_parser(false);
+        std::string arg = "@" + path;
+        std::vector<std::string_view> args{arg};
+        bench.run([&]
+        {
+            auto result = parser.parse(args);
+            auto n = result.values("FILE").size();
+            argos_bench::do_not_optimize(n);
+        });
+        std::remove(path.c_str());
+    }
+}
+
+ARGOS_BENCHMARK("ResponseFiles/200k/argv")
+{
+    parse_argv(bench, false);
+}
+
+ARGOS_BENCHMARK("ResponseFiles/200k/argv_borrowed")
+{
+    parse_argv(bench, true);
+}
+
+ARGOS_BENCHMARK("ResponseFiles/200k/newline_separated")
+{
+    parse_response_file(bench, '\n');
+}
+
+ARGOS_BENCHMARK("ResponseFiles/200k/nul_separated")
+{
+    parse_response_file(bench, '\0');
+}
@@ -0,0 +1,100 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    std::string make_ints(size_t count)
+    {
+        std::string result;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i != 0)
+                result += ',';
+            result += std::to_string((i * 2654435761u) % 1000000);
+        }
+        return result;
+    }
+
+    std::string make_doubles(size_t count)
+    {
+        std::string result;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (i != 0)
+                result += ',';
+            result += std::to_string(double(i % 1000) / 1000.0);
+        }
+        return result;
+    }
+
+    argos::ParsedArguments parse(const std::string& value)
+    {
+        using namespace argos;
+        return ArgumentParser("bench")
+            .auto_exit(false)
+            .add(Option{"--values"}.argument("N[,N]*"))
+            .parse({"--values", value});
+    }
+}
+
+ARGOS_BENCHMARK("SplitValues/ints/100k/split")
+{
+    auto value = make_ints(100000);
+    auto args = parse(value);
+    bench.run([&]
+    {
+        auto result = args.value("--values").split(',');
+        argos_bench::do_not_optimize(result);
+    });
+}
+
+ARGOS_BENCHMARK("SplitValues/ints/100k/split_then_as_ints")
+{
+    auto value = make_ints(100000);
+    auto args = parse(value);
+    bench.run([&]
+    {
+        auto result = args.value("--values").split(',').as_ints();
+        argos_bench::do_not_optimize(result);
+    });
+}
+
+ARGOS_BENCHMARK("SplitValues/ints/100k/split_as_ints")
+{
+    auto value = make_ints(100000);
+    auto args = parse(value);
+    bench.run([&]
+    {
+        auto result = args.value("--values").split_as_ints(',');
+        argos_bench::do_not_optimize(result);
+    });
+}
+
+ARGOS_BENCHMARK("SplitValues/doubles/100k/split_then_as_doubles")
+{
+    auto value = make_doubles(100000);
+    auto args = parse(value);
+    bench.run([&]
+    {
+        auto result = args.value("--values").split(',').as_doubles();
+        argos_bench::do_not_optimize(result);
+    });
+}
+
+ARGOS_BENCHMARK("SplitValues/doubles/100k/split_as_doubles")
+{
+    auto value = make_doubles(100000);
+    auto args = parse(value);
+    bench.run([&]
+    {
+        auto result = args.value("--values").split_as_doubles(',');
+        argos_bench::do_not_optimize(result);
+    });
+}
@@ -0,0 +1,153 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <string>
+#include "Argos/StringUtilities.hpp"
+#include "Benchmark.hpp"
+
+namespace
+{
+    const char HELP_EN[] =
+        "Reads the input files and writes the records that match the given"
+        " expression to the output file. If no input files are given, the"
+        " records are read from standard input. The expression can refer to"
+        " any of the columns in the input, by name or by position, and can"
+        " combine conditions with the usual logical operators. Use --format"
+        " to choose between CSV, JSON and the native binary format.";
+
+    const char HELP_NB[] =
+        "Leser inndatafilene og skriver postene som samsvarer med det gitte"
+        " uttrykket til utdatafilen. Hvis ingen inndatafiler er gitt, leses"
+        " postene fra standard inndata. Uttrykket kan referere til hvilke"
+        " som helst av kolonnene i inndataene, ved navn eller posisjon, og"
+        " kan kombinere betingelser med de vanlige logiske operatørene. Bruk"
+        " --format for å velge mellom CSV, JSON og det opprinnelige binære"
+        " formatet. Særlig nyttig når én fil må behandles på nytt.";
+
+    const char HELP_JA[] =
+        "入力ファイルを読み込み、指定された式に一致するレコードを出力ファイルに"
+        "書き込みます。入力ファイルが指定されていない場合、レコードは標準入力から"
+        "読み込まれます。式は入力の任意の列を名前または位置で参照でき、通常の"
+        "論理演算子で条件を組み合わせることができます。--format を使用して、"
+        "CSV、JSON、およびネイティブのバイナリ形式から選択します。";
+
+    std::string repeat(std::string_view text, size_t size)
+    {
+        std::string result;
+        result.reserve(size + text.size());
+        while (result.size() < size)
+            result += text;
+        return result;
+    }
+
+    std::vector<std::string_view> split_words(std::string_view text)
+    {
+        std::vector<std::string_view> words;
+        size_t start = 0;
+        while (start < text.size())
+        {
+            auto end = text.find(' ', start);
+            if (end == std::string_view::npos)
+                end = text.size();
+            words.push_back(text.substr(start, end - start));
+            start = end + 1;
+        }
+        return words;
+    }
+
+    // TextWriter counts the code points in one word at a time.
+    void count_words(argos_bench::Benchmark& bench, std::string_view text)
+    {
+        auto words = split_words(text);
+        bench.set_rate("bytes", text.size());
+        size_t n = 0;
+        bench.run([&]
+        {
+            for (auto word : words)
+                n += argos::count_code_points(word);
+            argos_bench::do_not_optimize(n);
+        });
+    }
+
+    void count_text(argos_bench::Benchmark& bench, const std::string& text)
+    {
+        bench.set_rate("bytes", text.size());
+        size_t n = 0;
+        bench.run([&]
+        {
+            n = argos::count_code_points(text);
+            argos_bench::do_not_optimize(n);
+        });
+    }
+
+    void find_middle(argos_bench::Benchmark& bench, const std::string& text)
+    {
+        const auto n = argos::count_code_points(text) / 2;
+        bench.set_rate("bytes", text.size() / 2);
+        size_t pos = 0;
+        bench.run([&]
+        {
+            pos = argos::find_nth_code_point(text, n);
+            argos_bench::do_not_optimize(pos);
+        });
+    }
+}
+
+ARGOS_BENCHMARK("CodePoints/words/english")
+{
+    count_words(bench, HELP_EN);
+}
+
+ARGOS_BENCHMARK("CodePoints/words/norwegian")
+{
+    count_words(bench, HELP_NB);
+}
+
+ARGOS_BENCHMARK("CodePoints/words/japanese")
+{
+    count_words(bench, HELP_JA);
+}
+
+ARGOS_BENCHMARK("CodePoints/text/english")
+{
+    count_text(bench, HELP_EN);
+}
+
+ARGOS_BENCHMARK("CodePoints/text/norwegian")
+{
+    count_text(bench, HELP_NB);
+}
+
+ARGOS_BENCHMARK("CodePoints/text/japanese")
+{
+    count_text(bench, HELP_JA);
+}
+
+ARGOS_BENCHMARK("CodePoints/1MB/english")
+{
+    count_text(bench, repeat(HELP_EN, 1 << 20));
+}
+
+ARGOS_BENCHMARK("CodePoints/1MB/norwegian")
+{
+    count_text(bench, repeat(HELP_NB, 1 << 20));
+}
+
+ARGOS_BENCHMARK("CodePoints/1MB/japanese")
+{
+    count_text(bench, repeat(HELP_JA, 1 << 20));
+}
+
+ARGOS_BENCHMARK("FindCodePoint/1MB/english")
+{
+    find_middle(bench, repeat(HELP_EN, 1 << 20));
+}
+
+ARGOS_BENCHMARK("FindCodePoint/1MB/japanese")
+{
+    find_middle(bench, repeat(HELP_JA, 1 << 20));
+}
@@ -0,0 +1,75 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    constexpr int SUBCOMMAND_COUNT = 60;
+
+    argos::ArgumentParser make_subcommand_parser(const std::string& name)
+    {
+        using namespace argos;
+        ArgumentParser parser(name);
+        parser.auto_exit(false)
+            .about("The " + name + " command does something useful with"
+                   " the files given on the command line.");
+        for (int i = 0; i < 20; ++i)
+        {
+            auto n = std::to_string(i);
+            parser.add(Option{"--option-" + n}.argument("VALUE")
+                           .help("Sets the value of option " + n + "."));
+        }
+        parser.add(Argument("FILE").count(0, 100)
+                       .help("The files to process."));
+        return parser;
+    }
+
+    std::string subcommand_name(int i)
+    {
+        return "command" + std::to_string(i);
+    }
+
+    const std::vector<std::string_view> ARGS = {
+        "command42", "--option-3", "abc", "file1", "file2"};
+}
+
+ARGOS_BENCHMARK("Subcommands/60/define_and_parse")
+{
+    bench.run([&]
+    {
+        using namespace argos;
+        ArgumentParser parser("program");
+        parser.auto_exit(false);
+        for (int i = 0; i < SUBCOMMAND_COUNT; ++i)
+        {
+            auto name = subcommand_name(i);
+            parser.add(Subcommand(name, [name]
+            {
+                return make_subcommand_parser(name);
+            }).help("Runs " + name + "."));
+        }
+        auto result = parser.parse(ARGS);
+        argos_bench::do_not_optimize(result);
+    });
+}
+
+ARGOS_BENCHMARK("Subcommands/60/eager_parsers")
+{
+    // All the subcommand parsers are created before one of them is
+    // selected, as programs had to do without subcommand support.
+    bench.run([&]
+    {
+        std::vector<argos::ArgumentParser> parsers;
+        for (int i = 0; i < SUBCOMMAND_COUNT; ++i)
+            parsers.push_back(make_subcommand_parser(subcommand_name(i)));
+        std::vector<std::string_view> args(ARGS.begin() + 1, ARGS.end());
+        auto result = parsers[42].parse(args);
+        argos_bench::do_not_optimize(result);
+    });
+}
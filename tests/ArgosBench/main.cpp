@@ -0,0 +1,113 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <Argos/Argos.hpp>
+#include "Benchmark.hpp"
+
+namespace
+{
+    std::string to_json_string(const std::string& str)
+    {
+        std::string result = "\"";
+        for (char c : str)
+        {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            result += c;
+        }
+        result += '"';
+        return result;
+    }
+
+    // Writes the results in a format that can be compared between runs
+    // with tools like jq.
+    void write_json(std::ostream& stream,
+                    const std::vector<argos_bench::BenchmarkResult>& results)
+    {
+        stream << std::fixed << std::setprecision(1) << "{\n"
+               << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& result = results[i];
+            stream << (i == 0 ? "\n" : ",\n")
+                   << "    {\n"
+                   << "      \"name\": " << to_json_string(result.name)
+                   << ",\n"
+                   << "      \"iterations\": " << result.iterations << ",\n"
+                   << "      \"ns_per_op\": " << result.ns_per_op << ",\n"
+                   << "      \"allocs_per_op\": "
+                   << result.allocations_per_op << ",\n"
+                   << "      \"bytes_per_op\": " << result.bytes_per_op;
+            if (result.items_per_op != 0 && result.ns_per_op > 0)
+            {
+                stream << ",\n"
+                       << "      \"rate_unit\": "
+                       << to_json_string(result.rate_unit) << ",\n"
+                       << "      \"items_per_second\": "
+                       << double(result.items_per_op) * 1e9
+                          / result.ns_per_op;
+            }
+            stream << "\n    }";
+        }
+        stream << "\n  ]\n}\n";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace argos;
+    const auto args = ArgumentParser(argv[0])
+        .about("Runs the Argos benchmarks.")
+        .add(Argument("FILTER").optional(true)
+                 .help("Only run benchmarks whose name contain FILTER."))
+        .add(Option{"--min-time"}.argument("SECONDS")
+                 .help("The minimum time spent measuring each benchmark."
+                       " The default is 0.5."))
+        .add(Option{"--json"}.argument("FILE")
+                 .help("Also write the results to FILE in JSON format."))
+        .parse(argc, argv);
+
+    if (auto min_time = args.value("--min-time"))
+        argos_bench::set_min_time(min_time.as_double());
+    auto filter = args.value("FILTER").as_string();
+
+    std::vector<argos_bench::BenchmarkResult> results;
+    for (const auto& [name, func] : argos_bench::benchmarks())
+    {
+        if (name.find(filter) == std::string::npos)
+            continue;
+        argos_bench::Benchmark bench(name);
+        func(bench);
+        const auto& result = bench.result();
+        std::printf("%-48s %12.0f ns/op %10.1f allocs/op %12.0f B/op"
+                    " %10llu iterations",
+                    result.name.c_str(), result.ns_per_op,
+                    result.allocations_per_op, result.bytes_per_op,
+                    static_cast<unsigned long long>(result.iterations));
+        if (result.items_per_op != 0 && result.ns_per_op > 0)
+        {
+            std::printf(" %14.0f %s/s",
+                        double(result.items_per_op) * 1e9 / result.ns_per_op,
+                        result.rate_unit.c_str());
+        }
+        std::printf("\n");
+        std::fflush(stdout);
+        results.push_back(result);
+    }
+
+    if (auto json = args.value("--json"))
+    {
+        std::ofstream file(json.as_string());
+        if (!file)
+            json.error("can not create file: " + json.as_string());
+        write_json(file, results);
+    }
+    return 0;
+}
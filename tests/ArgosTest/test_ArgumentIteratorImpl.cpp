@@ -0,0 +1,195 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "Argos/ArgumentIteratorImpl.hpp"
+#include "Argos/Argument.hpp"
+#include "Argos/Option.hpp"
+
+namespace
+{
+    // Other tests run parsers on several threads, only the allocations
+    // made by a thread with an AllocationCounter are counted.
+    std::atomic<size_t> allocation_count = 0;
+    thread_local bool is_counting_allocations = false;
+
+    void* allocate(size_t size)
+    {
+        if (is_counting_allocations)
+            allocation_count.fetch_add(1, std::memory_order_relaxed);
+        if (auto* p = std::malloc(size ? size : 1))
+            return p;
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return allocate(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+    // Counts the allocations made by the current thread while it exists.
+    class AllocationCounter
+    {
+    public:
+        AllocationCounter()
+            : m_before(allocation_count)
+        {
+            is_counting_allocations = true;
+        }
+
+        AllocationCounter(const AllocationCounter&) = delete;
+
+        ~AllocationCounter()
+        {
+            is_counting_allocations = false;
+        }
+
+        AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+        [[nodiscard]] size_t count() const
+        {
+            return allocation_count - m_before;
+        }
+    private:
+        size_t m_before;
+    };
+
+    std::shared_ptr<const argos::ParserData> make_parser_data(bool borrow)
+    {
+        using namespace argos;
+        auto data = std::make_shared<ParserData>();
+        data->parser_settings.auto_exit = false;
+        data->parser_settings.borrow_arguments = borrow;
+        data->arguments.push_back(Argument("FILE").release());
+        data->options.push_back(Option{"-x"}.constant("1").release());
+        data->options.push_back(Option{"-v"}.constant("1").release());
+        data->options.push_back(Option{"-z"}.constant("1").release());
+        data->options.push_back(Option{"--name"}.argument("NAME").release());
+        data->options.push_back(Option{"--level"}.argument("N").release());
+        finalize_parser_data(*data);
+        return data;
+    }
+
+    size_t count_allocations(argos::ArgumentIteratorImpl& iterator,
+                             size_t& tokens)
+    {
+        AllocationCounter counter;
+        while (true)
+        {
+            auto code = std::get<0>(iterator.next());
+            if (code == argos::IteratorResultCode::DONE
+                || code == argos::IteratorResultCode::ERROR)
+            {
+                break;
+            }
+            ++tokens;
+        }
+        return counter.count();
+    }
+}
+
+TEST_CASE("ArgumentIteratorImpl::next does not allocate")
+{
+    using namespace argos;
+    std::vector<std::string_view> args{
+        "-xvz", "--name=value", "--level", "3", "file", "-x", "--level=4"};
+    size_t tokens = 0;
+
+    SECTION("Borrowed arguments")
+    {
+        ArgumentIteratorImpl iterator(args, make_parser_data(true));
+        REQUIRE(count_allocations(iterator, tokens) == 0);
+        REQUIRE(tokens == 8);
+        auto& parsed = *iterator.parsed_arguments();
+        REQUIRE(parsed.result_code() == ParserResultCode::SUCCESS);
+        REQUIRE(parsed.get_value(parsed.get_value_id("--level"))->first
+                == "4");
+    }
+
+    SECTION("Copied arguments")
+    {
+        // The string store allocates its first block and the list
+        // that holds it, nothing else.
+        ArgumentIteratorImpl iterator(args, make_parser_data(false));
+        REQUIRE(count_allocations(iterator, tokens) <= 2);
+        REQUIRE(tokens == 8);
+        auto& parsed = *iterator.parsed_arguments();
+        REQUIRE(parsed.result_code() == ParserResultCode::SUCCESS);
+    }
+}
+
+TEST_CASE("ArgumentIteratorImpl::reset reuses memory")
+{
+    using namespace argos;
+    std::vector<std::string_view> args1{
+        "-xvz", "--name=value", "--level", "3", "file", "-x", "--level=4"};
+    std::vector<std::string_view> args2{"--name", "other", "file2"};
+    auto data = make_parser_data(false);
+
+    ArgumentIteratorImpl iterator(args1, data);
+    auto parse_round = [&]
+    {
+        iterator.parse_all();
+        iterator.reset(args2, data);
+        iterator.parse_all();
+        iterator.reset("-x --name 'a value' file3", data);
+        iterator.parse_all();
+        iterator.reset(args1, data);
+    };
+
+    // The first rounds grow the buffers to the sizes required.
+    parse_round();
+    parse_round();
+    size_t allocations;
+    {
+        AllocationCounter counter;
+        parse_round();
+        parse_round();
+        allocations = counter.count();
+    }
+    REQUIRE(allocations == 0);
+
+    iterator.parse_all();
+    iterator.reset("-x --name 'a value' file3", data);
+    iterator.parse_all();
+    auto& parsed = *iterator.parsed_arguments();
+    REQUIRE(parsed.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(parsed.get_value(parsed.get_value_id("--name"))->first
+            == "a value");
+    REQUIRE(!parsed.has(parsed.get_value_id("--level")));
+}
@@ -8,7 +8,9 @@
 #include <catch2/catch_test_macros.hpp>
 #include "Argos/ArgumentParser.hpp"
 
+#include <atomic>
 #include <sstream>
+#include <thread>
 #include "Argv.hpp"
 
 TEST_CASE("Test help flag")
@@ -342,6 +344,81 @@ TEST_CASE("Argument with variable count")
     }
 }
 
+TEST_CASE("Variable count between fixed counts")
+{
+    using namespace argos;
+    const auto parser = argos::ArgumentParser("test")
+        .auto_exit(false)
+        .add(Argument("A").count(1))
+        .add(Argument("B").count(0, 3))
+        .add(Argument("C").count(1))
+        .add(Option{"-v"})
+        .add(Option{"--stop"}.type(OptionType::STOP))
+        .move();
+    SECTION("Options between arguments")
+    {
+        auto args = parser.parse({"a", "-v", "b", "c", "-v", "d", "e"});
+        REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+        REQUIRE(args.value("A").as_string() == "a");
+        REQUIRE(args.values("B").as_strings()
+                == std::vector<std::string>{"b", "c", "d"});
+        REQUIRE(args.value("C").as_string() == "e");
+    }
+    SECTION("Stop option")
+    {
+        auto args = parser.parse({"a", "b", "--stop", "c", "d"});
+        REQUIRE(args.result_code() == ParserResultCode::STOP);
+        REQUIRE(args.value("A").as_string() == "a");
+        REQUIRE(!args.has("B"));
+        REQUIRE(args.value("C").as_string() == "b");
+        REQUIRE(args.unprocessed_arguments()
+                == std::vector<std::string>{"c", "d"});
+    }
+    SECTION("Iterator returns arguments in order")
+    {
+        auto it = parser.make_iterator({"a", "b", "-v", "c"});
+        std::unique_ptr<IArgumentView> arg;
+        std::string_view value;
+        std::vector<std::string> names, values;
+        while (it.next(arg, value))
+        {
+            auto view = dynamic_cast<const ArgumentView*>(arg.get());
+            names.push_back(view ? view->name() : "-v");
+            values.emplace_back(value);
+        }
+        REQUIRE(names == std::vector<std::string>{"A", "-v", "B", "C"});
+        REQUIRE(values == std::vector<std::string>{"a", "", "b", "c"});
+    }
+    SECTION("Too many arguments")
+    {
+        auto args = argos::ArgumentParser("test")
+            .auto_exit(false)
+            .ignore_undefined_arguments(true)
+            .add(Argument("A").count(0, 1))
+            .add(Argument("B").count(1))
+            .add(Option{"-v"})
+            .parse({"a", "b", "c", "-v", "d"});
+        REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+        REQUIRE(args.value("A").as_string() == "a");
+        REQUIRE(args.value("B").as_string() == "b");
+        REQUIRE(args.unprocessed_arguments()
+                == std::vector<std::string>{"c", "d"});
+    }
+    SECTION("Too few arguments")
+    {
+        std::stringstream ss;
+        auto args = argos::ArgumentParser("test")
+            .auto_exit(false)
+            .stream(&ss)
+            .add(Argument("A").count(1))
+            .add(Argument("B").count(0, 3))
+            .add(Argument("C").count(1))
+            .parse({"a"});
+        REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+        REQUIRE(ss.str().find("Too few arguments") != std::string::npos);
+    }
+}
+
 TEST_CASE("CLEAR option")
 {
     using namespace argos;
@@ -378,6 +455,124 @@ TEST_CASE("CLEAR option")
     REQUIRE(it.parsed_arguments().value("--bud").as_bool());
 }
 
+TEST_CASE("COUNT option")
+{
+    using namespace argos;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Option({"-v", "--verbose"}).alias("VERBOSITY")
+             .operation(OptionOperation::COUNT).limits(0, 3))
+        .add(Option({"-q"}).alias("VERBOSITY")
+             .operation(OptionOperation::COUNT).constant(-1).limits(0, 3))
+        .add(Option({"--verbosity"}).alias("VERBOSITY").argument("N"))
+        .add(Option({"--no-verbose"}).alias("VERBOSITY")
+             .operation(OptionOperation::CLEAR))
+        .add(Option({"-I"}).operation(OptionOperation::COUNT))
+        .move();
+
+    SECTION("Repeated flags are counted")
+    {
+        auto args = parser.parse({"-vv", "-v", "-q"});
+        REQUIRE(args.value("VERBOSITY").as_int() == 2);
+        REQUIRE(args.value("VERBOSITY").as_string() == "2");
+        REQUIRE(args.values("VERBOSITY").size() == 1);
+        REQUIRE_FALSE(args.has("-I"));
+    }
+
+    SECTION("The count stays within the limits")
+    {
+        REQUIRE(parser.parse({"-vvvvvv"}).value("-v").as_int() == 3);
+        REQUIRE(parser.parse({"-qq", "-v"}).value("-v").as_int() == 1);
+    }
+
+    SECTION("Counting continues from an assigned value")
+    {
+        auto args = parser.parse({"--verbosity", "1", "-v"});
+        REQUIRE(args.value("-v").as_int() == 2);
+        args = parser.parse({"-vv", "--verbosity", "0", "-v"});
+        REQUIRE(args.value("-v").as_int() == 1);
+    }
+
+    SECTION("CLEAR resets the count")
+    {
+        auto args = parser.parse({"-vv", "--no-verbose"});
+        REQUIRE_FALSE(args.has("-v"));
+        args = parser.parse({"-vv", "--no-verbose", "-v"});
+        REQUIRE(args.value("-v").as_int() == 1);
+    }
+
+    SECTION("Thousands of repetitions")
+    {
+        std::vector<std::string_view> argv(5000, "-I");
+        auto args = parser.parse(argv);
+        REQUIRE(args.value("-I").as_int() == 5000);
+        REQUIRE(args.value("-I").as_uint() == 5000);
+        REQUIRE(args.value("-I").as_int(0, 16) == 0x5000);
+    }
+}
+
+TEST_CASE("Invalid COUNT options")
+{
+    using namespace argos;
+    ArgumentParser parser("test");
+    REQUIRE_THROWS(parser.add(Option({"-v"}).argument("N")
+                                  .operation(OptionOperation::COUNT)));
+    REQUIRE_THROWS(parser.add(Option({"-v"}).constant("many")
+                                  .operation(OptionOperation::COUNT)));
+    REQUIRE_THROWS(parser.add(Option({"-v"}).limits(0, 3)));
+    REQUIRE_THROWS(Option({"-v"}).limits(3, 0));
+}
+
+TEST_CASE("COUNT option bound to a variable")
+{
+    using namespace argos;
+    int verbosity = 0;
+    unsigned level = 0;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Option({"-v"}).operation(OptionOperation::COUNT)
+             .bind(&verbosity))
+        .add(Option({"-d"}).operation(OptionOperation::COUNT).constant(-1)
+             .bind(&level))
+        .move();
+    auto args = parser.parse({"-vvv"});
+    REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(verbosity == 3);
+    args = parser.parse({"-d"});
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(ss.str().find("-d: invalid value \"-1\".") != std::string::npos);
+}
+
+TEST_CASE("Bound COUNT option continues from assigned values")
+{
+    using namespace argos;
+    int v = 0;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Option({"-v"}).alias("LEVEL")
+             .operation(OptionOperation::COUNT).bind(&v))
+        .add(Option({"--level"}).alias("LEVEL").argument("N")
+             .initial_value("5"))
+        .add(Option({"--reset"}).alias("LEVEL").constant(2))
+        .add(Option({"--clear"}).alias("LEVEL")
+             .operation(OptionOperation::CLEAR))
+        .move();
+
+    auto args = parser.parse({"-v"});
+    REQUIRE(v == 6);
+    REQUIRE(args.has("-v"));
+    REQUIRE(args.value("-v").as_string().empty());
+
+    (void)parser.parse({"--level", "1", "-vv"});
+    REQUIRE(v == 3);
+    (void)parser.parse({"-vvv", "--reset", "-v"});
+    REQUIRE(v == 3);
+    (void)parser.parse({"--clear", "-v"});
+    REQUIRE(v == 1);
+}
+
 TEST_CASE("Conflicting case-insensitive options")
 {
     argos::ArgumentParser argos("test");
@@ -749,6 +944,64 @@ TEST_CASE("Test options with initial_value")
     }
 }
 
+TEST_CASE("Typed constants and initial values")
+{
+    using namespace argos;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Option{"--flag"})
+        .add(Option{"--off"}.constant(false))
+        .add(Option{"--big"}.constant(5000000000LL))
+        .add(Option{"--ratio"}.constant(0.1))
+        .add(Option{"--level"}.argument("N").initial_value(3))
+        .add(Option{"--scale"}.argument("X").initial_value(2.5))
+        .add(Option{"--name"}.argument("NAME").initial_value("abc"))
+        .move();
+
+    SECTION("Constants")
+    {
+        auto args = parser.parse({"--flag", "--off", "--big", "--ratio"});
+        REQUIRE(args.value("--flag").as_bool());
+        REQUIRE(args.value("--flag").as_int() == 1);
+        REQUIRE(args.value("--flag").as_string() == "1");
+        REQUIRE_FALSE(args.value("--off").as_bool());
+        REQUIRE(args.value("--off").as_double() == 0.0);
+        REQUIRE(args.value("--off").as_string() == "0");
+        REQUIRE(args.value("--big").as_llong() == 5000000000LL);
+        REQUIRE(args.value("--big").as_double() == 5e9);
+        REQUIRE(args.value("--big").as_string() == "5000000000");
+        REQUIRE(args.value("--ratio").as_double() == 0.1);
+        REQUIRE(args.value("--ratio").as_float() == 0.1f);
+        REQUIRE(args.value("--ratio").as_string() == "0.1");
+    }
+
+    SECTION("Conversion errors are reported as for strings")
+    {
+        auto args = parser.parse({"--big", "--ratio"});
+        REQUIRE_THROWS(args.value("--big").as_int());
+        REQUIRE(args.value("--big").as_llong(0, 16) == 0x5000000000LL);
+        REQUIRE_THROWS(args.value("--ratio").as_int());
+    }
+
+    SECTION("Initial values")
+    {
+        auto args = parser.parse(std::vector<std::string_view>{});
+        REQUIRE(args.value("--level").as_int() == 3);
+        REQUIRE(args.value("--level").as_string() == "3");
+        REQUIRE(args.value("--scale").as_double() == 2.5);
+        REQUIRE(args.value("--name").as_string() == "abc");
+    }
+
+    SECTION("Command line values replace initial values")
+    {
+        auto args = parser.parse({"--level", "0x10", "--scale", "4"});
+        REQUIRE(args.value("--level").as_int(0, 0) == 16);
+        REQUIRE(args.value("--scale").as_double() == 4.0);
+    }
+}
+
 TEST_CASE("Version option")
 {
     using namespace argos;
@@ -786,3 +1039,205 @@ TEST_CASE("Check that program name is taken from argv[0]")
     REQUIRE(help_text.substr(8, 4) == "test");
     REQUIRE(help_text.substr(22, 4) == "test");
 }
+
+TEST_CASE("Const parser can be reused and modified between parses")
+{
+    using namespace argos;
+    ArgumentParser parser("test");
+    parser.auto_exit(false)
+        .add(Option({"-a"}))
+        .add(Argument("FILE").count(0, 1));
+    const auto& const_parser = parser;
+    auto args1 = const_parser.parse({"-a", "file1"});
+    REQUIRE(args1.value("-a").as_bool());
+    REQUIRE(args1.value("FILE").as_string() == "file1");
+
+    auto args2 = const_parser.parse({"file2"});
+    REQUIRE(!args2.has("-a"));
+    REQUIRE(args2.value("FILE").as_string() == "file2");
+
+    parser.add(Option({"--bb"}));
+    auto args3 = const_parser.parse({"--bb"});
+    REQUIRE(args3.value("--bb").as_bool());
+    REQUIRE(args1.value("FILE").as_string() == "file1");
+
+    parser.add(Option({"-a"}));
+    REQUIRE_THROWS(const_parser.parse({"-a"}));
+}
+
+TEST_CASE("Const parser shared by several threads")
+{
+    using namespace argos;
+    std::stringstream ss;
+    ArgumentParser parser("test");
+    parser.auto_exit(false)
+        .stream(&ss)
+        .add(Option({"-n", "--number"}).argument("N"))
+        .add(Option({"-v", "--verbose"}).operation(OptionOperation::APPEND)
+            .constant(1))
+        .add(Argument("FILE").count(1, 100));
+    const auto& const_parser = parser;
+
+    constexpr int THREAD_COUNT = 8;
+    constexpr int ITERATIONS = 500;
+    std::atomic<int> failures = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            auto n = std::to_string(i);
+            for (int j = 0; j < ITERATIONS; ++j)
+            {
+                auto args = const_parser.parse({"-vv", "--number", n,
+                                                "file1", "file2", "-v"});
+                if (args.value("--number").as_int() != i
+                    || args.values("-v").size() != 3
+                    || args.values("FILE").size() != 2)
+                {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(failures == 0);
+    REQUIRE(ss.str().empty());
+}
+
+TEST_CASE("Borrowed arguments refer to the command line")
+{
+    using namespace argos;
+    Argv argv{{"test", "--name=abc", "-v", "file", "--", "rest"}};
+    auto args = ArgumentParser("test")
+        .auto_exit(false)
+        .borrow_arguments(true)
+        .add(Argument("FILE"))
+        .add(Option{"--name"}.argument("NAME"))
+        .add(Option{"-v"}.constant("yes")
+                 .callback([](auto, auto, auto builder)
+                           {
+                               builder.assign("--extra", "built");
+                               return true;
+                           }))
+        .add(Option{"--extra"}.argument("VALUE"))
+        .add(Option{"--"}.type(OptionType::LAST_ARGUMENT))
+        .ignore_undefined_arguments(true)
+        .parse(argv.size(), argv.data());
+    auto file = args.value("FILE").as_string();
+    REQUIRE(file == "file");
+    REQUIRE(args.value("FILE").value()->data() == argv.argv[3]);
+    REQUIRE(args.value("--name").value()->data() == argv.argv[1] + 7);
+    REQUIRE(args.value("-v").as_string() == "yes");
+    REQUIRE(args.value("--extra").as_string() == "built");
+    REQUIRE(args.unprocessed_arguments()
+            == std::vector<std::string>{"rest"});
+}
+
+TEST_CASE("Parse a batch of command lines")
+{
+    using namespace argos;
+    std::stringstream ss;
+    ArgumentParser parser("test");
+    parser.stream(&ss)
+        .add(Option({"-n", "--number"}).argument("N"))
+        .add(Argument("FILE").count(1, 100));
+    const auto& const_parser = parser;
+
+    std::vector<std::string> numbers;
+    for (int i = 0; i < 1000; ++i)
+        numbers.push_back(std::to_string(i));
+    std::vector<std::vector<std::string_view>> command_lines;
+    for (size_t i = 0; i < numbers.size(); ++i)
+    {
+        if (i % 100 == 7)
+            command_lines.push_back({"--bad", "file"});
+        else
+            command_lines.push_back({"-n", numbers[i], "file"});
+    }
+
+    auto results = const_parser.parse_batch(command_lines, 4);
+    REQUIRE(results.size() == command_lines.size());
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        CAPTURE(i);
+        if (i % 100 == 7)
+        {
+            REQUIRE(results[i].result_code() == ParserResultCode::FAILURE);
+            REQUIRE(results[i].error_message() == "Unknown option: --bad");
+        }
+        else
+        {
+            REQUIRE(results[i].result_code() == ParserResultCode::SUCCESS);
+            REQUIRE(results[i].value("--number").as_int() == int(i));
+            REQUIRE(results[i].error_message().empty());
+        }
+    }
+    REQUIRE(ss.str().empty());
+    REQUIRE(const_parser.parse_batch({}).empty());
+}
+
+TEST_CASE("Parse a batch without writing help, version or errors")
+{
+    using namespace argos;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("test")
+        .stream(&ss)
+        .version("1.0")
+        .add(Option({"-n", "--number"}).argument("N"))
+        .move();
+
+    auto results = parser.parse_batch({{"--help"}, {"--version"},
+                                       {"-n", "abc"}});
+    REQUIRE(results[0].result_code() == ParserResultCode::STOP);
+    REQUIRE(results[1].result_code() == ParserResultCode::STOP);
+    REQUIRE(results[2].result_code() == ParserResultCode::SUCCESS);
+    REQUIRE_THROWS(results[2].value("-n").as_int());
+    REQUIRE(ss.str().empty());
+}
+
+TEST_CASE("Parse with a ParseContext")
+{
+    using namespace argos;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Argument("FILE").count(1, 2))
+        .add(Argument("DEST"))
+        .add(Option{"-n", "--name"}.argument("NAME"))
+        .add(Option{"-v"})
+        .move();
+
+    ParseContext context;
+    auto args = parser.parse({"-v", "a", "b", "c"}, context);
+    REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(args.value("-v").as_bool());
+    REQUIRE(args.values("FILE").as_strings()
+            == std::vector<std::string>{"a", "b"});
+    REQUIRE(args.value("DEST").as_string() == "c");
+
+    // The first result is still referenced and must not change.
+    auto args2 = parser.parse_command_line("-n 'x y' d e", context);
+    REQUIRE(args2.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(args2.value("--name").as_string() == "x y");
+    REQUIRE(!args2.value("-v").as_bool());
+    REQUIRE(args2.values("FILE").as_strings()
+            == std::vector<std::string>{"d"});
+    REQUIRE(args.values("FILE").as_strings()
+            == std::vector<std::string>{"a", "b"});
+    REQUIRE(args.value("DEST").as_string() == "c");
+
+    args = {};
+    args2 = {};
+    args = parser.parse({"-n"}, context);
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+    args = {};
+    args = parser.parse({"f", "g"}, context);
+    REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(!args.value("--name"));
+    REQUIRE(args.values("FILE").as_strings()
+            == std::vector<std::string>{"f"});
+    REQUIRE(args.value("DEST").as_string() == "g");
+}
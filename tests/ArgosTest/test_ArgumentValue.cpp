@@ -9,6 +9,7 @@
 #include "Argos/ArgumentParser.hpp"
 
 #include <cstring>
+#include <sstream>
 
 TEST_CASE("Test ArgumentValue split")
 {
@@ -67,3 +68,69 @@ TEST_CASE("ArgumentValueIterator")
     }
     REQUIRE(i == strlen(expected));
 }
+
+TEST_CASE("Split and convert values in one step")
+{
+    using namespace argos;
+    std::stringstream ss;
+    auto args = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Option{"-i"}.argument("N[,N]*")
+                 .operation(OptionOperation::APPEND))
+        .add(Option{"-d"}.argument("X[,X]*"))
+        .add(Option{"-x"}.argument("N[,N]*"))
+        .add(Option{"-e"}.argument("N[,N]*"))
+        .parse({"-i", "1,-2,3", "-i", "40", "-d", "0.5,-1e3",
+                "-x", "ff,0x10", "-e", "1,,2"});
+
+    REQUIRE(args.values("-i").value(0).split_as_ints(',')
+            == std::vector<int>{1, -2, 3});
+    REQUIRE(args.values("-i").split_as_ints(',')
+            == std::vector<int>{1, -2, 3, 40});
+    REQUIRE(args.values("-i").split_as_llongs(',')
+            == args.values("-i").split(',').as_llongs());
+    REQUIRE(args.value("-d").split_as_doubles(',')
+            == std::vector<double>{0.5, -1000.0});
+    REQUIRE(args.values("-d").split_as_doubles(',')
+            == std::vector<double>{0.5, -1000.0});
+    REQUIRE(args.value("-x").split_as_llongs(',', {}, 16)
+            == std::vector<long long>{255, 16});
+    REQUIRE_THROWS(args.value("-e").split_as_ints(','));
+    REQUIRE_THROWS(args.values("-e").split_as_doubles(','));
+    REQUIRE_THROWS(args.value("-x").split_as_ints(','));
+}
+
+TEST_CASE("Split and convert reports errors like as_int")
+{
+    using namespace argos;
+    std::stringstream ss;
+    auto args = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Option{"-e"}.argument("N[,N]*"))
+        .parse({"-e", "1,,2"});
+
+    REQUIRE_THROWS(args.value("-e").as_int());
+    const auto expected = ss.str();
+    REQUIRE(expected.find("Invalid value: 1,,2.") != std::string::npos);
+
+    ss.str({});
+    REQUIRE_THROWS(args.value("-e").split_as_ints(','));
+    REQUIRE(ss.str() == expected);
+
+    ss.str({});
+    REQUIRE_THROWS(args.values("-e").split_as_doubles(','));
+    REQUIRE(ss.str() == expected);
+}
+
+TEST_CASE("Split and convert missing values")
+{
+    using namespace argos;
+    auto args = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Option{"-i"}.argument("N[,N]*"))
+        .parse(std::vector<std::string_view>{});
+    REQUIRE(args.value("-i").split_as_ints(',', {7}) == std::vector<int>{7});
+    REQUIRE(args.values("-i").split_as_doubles(',').empty());
+}
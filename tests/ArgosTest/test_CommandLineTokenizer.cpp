@@ -0,0 +1,104 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <sstream>
+#include <catch2/catch_test_macros.hpp>
+#include "Argos/Argos.hpp"
+#include "Argos/CommandLineTokenizer.hpp"
+
+namespace
+{
+    std::vector<std::string> tokenize(std::string text)
+    {
+        std::vector<std::string_view> tokens;
+        tokens.reserve(argos::max_token_count(text));
+        const auto capacity = tokens.capacity();
+        argos::tokenize_command_line(text.data(), text.size(), tokens);
+        REQUIRE(tokens.capacity() == capacity);
+        return {tokens.begin(), tokens.end()};
+    }
+}
+
+TEST_CASE("Tokenize command lines")
+{
+    using V = std::vector<std::string>;
+    REQUIRE(tokenize("").empty());
+    REQUIRE(tokenize("   ").empty());
+    REQUIRE(tokenize("ab") == V{"ab"});
+    REQUIRE(tokenize(" -a  --bb=c\td ") == V{"-a", "--bb=c", "d"});
+    REQUIRE(tokenize(R"(--name="John Smith" 'it''s')") == V{"--name=John Smith", "its"});
+    REQUIRE(tokenize(R"('a "b" c' "d 'e' f")") == V{R"(a "b" c)", "d 'e' f"});
+    REQUIRE(tokenize(R"(\"a \\ \ b\)") == V{"\"a", "\\", " b\\"});
+    REQUIRE(tokenize(R"(x "" '' y)") == V{"x", "", "", "y"});
+}
+
+TEST_CASE("Backslashes follow the POSIX shell rules")
+{
+    using V = std::vector<std::string>;
+    REQUIRE(tokenize(R"("C:\tmp\new")") == V{R"(C:\tmp\new)"});
+    REQUIRE(tokenize(R"("a\$b\`c\"d\\e")") == V{R"(a$b`c"d\e)"});
+    REQUIRE(tokenize(R"('a\b\'')") == V{R"(a\b\)"});
+    REQUIRE(tokenize("ab\\\ncd") == V{"abcd"});
+    REQUIRE(tokenize("\"ab\\\ncd\"") == V{"abcd"});
+    REQUIRE(tokenize("'ab\\\ncd'") == V{"ab\\\ncd"});
+    REQUIRE(tokenize("a \\\n b") == V{"a", "b"});
+    REQUIRE(tokenize("a\\\n\\\nb") == V{"ab"});
+}
+
+TEST_CASE("Max token count is an upper bound")
+{
+    REQUIRE(argos::max_token_count("") == 1);
+    REQUIRE(argos::max_token_count("a b  c") == 4);
+    REQUIRE(argos::max_token_count("'a b c'") == 3);
+}
+
+TEST_CASE("Parse command line")
+{
+    using namespace argos;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Argument("FILE").count(0, 10))
+        .add(Option{"-v"})
+        .add(Option{"--name"}.argument("NAME"))
+        .move();
+
+    std::string line = R"(-v --name 'John Smith' "file 1" file\ 2)";
+    auto args = parser.parse_command_line(line);
+    // The result must not refer to the caller's string.
+    line.assign(line.size(), 'x');
+    REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(args.value("-v").as_bool());
+    REQUIRE(args.value("--name").as_string() == "John Smith");
+    REQUIRE(args.values("FILE").as_strings()
+            == std::vector<std::string>{"file 1", "file 2"});
+
+    args = parser.parse_command_line("  ");
+    REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(!args.value("-v").as_bool());
+    REQUIRE(args.values("FILE").empty());
+}
+
+TEST_CASE("Parse command line with errors and unknown arguments")
+{
+    using namespace argos;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .ignore_undefined_arguments(true)
+        .ignore_undefined_options(true)
+        .add(Option{"--name"}.argument("NAME"))
+        .move();
+
+    auto args = parser.parse_command_line("--size 'a b' --name");
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+
+    args = parser.parse_command_line("--size 'a b'");
+    REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(args.unprocessed_arguments()
+            == std::vector<std::string>{"--size", "a b"});
+}
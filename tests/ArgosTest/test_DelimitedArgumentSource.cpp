@@ -0,0 +1,231 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <climits>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <catch2/catch_test_macros.hpp>
+#include "Argos/Argos.hpp"
+
+#ifdef _WIN32
+    #include <io.h>
+    #include <fcntl.h>
+    #define ARGOS_OPEN_FILE(path) _open(path, _O_RDONLY | _O_BINARY)
+    #define ARGOS_CLOSE_FILE _close
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #define ARGOS_OPEN_FILE(path) open(path, O_RDONLY)
+    #define ARGOS_CLOSE_FILE close
+#endif
+
+namespace
+{
+    // Splits args into batches of batch_size, and reuses its buffers
+    // the same way DelimitedArgumentSource does. Strings that are
+    // referred to after their batch has expired will have been
+    // overwritten.
+    class TestSource : public argos::IArgumentSource
+    {
+    public:
+        TestSource(std::vector<std::string> args, size_t batch_size)
+            : m_args(std::move(args)),
+              m_batch_size(batch_size)
+        {}
+
+        bool next_batch(std::vector<std::string_view>& args) override
+        {
+            args.clear();
+            if (m_index == m_args.size())
+                return false;
+
+            auto& buffer = m_buffers[m_batch_count++ % 2];
+            std::fill(buffer.begin(), buffer.end(), '#');
+            buffer.clear();
+            auto end = std::min(m_index + m_batch_size, m_args.size());
+            for (auto i = m_index; i < end; ++i)
+                buffer += m_args[i];
+            size_t pos = 0;
+            for (; m_index < end; ++m_index)
+            {
+                args.emplace_back(buffer.data() + pos, m_args[m_index].size());
+                pos += m_args[m_index].size();
+            }
+            return true;
+        }
+    private:
+        std::vector<std::string> m_args;
+        size_t m_batch_size;
+        size_t m_index = 0;
+        size_t m_batch_count = 0;
+        std::string m_buffers[2];
+    };
+
+    std::vector<std::string> read_all(argos::IArgumentSource& source)
+    {
+        std::vector<std::string> result;
+        std::vector<std::string_view> batch;
+        while (source.next_batch(batch))
+            result.insert(result.end(), batch.begin(), batch.end());
+        return result;
+    }
+
+    std::vector<std::string> read_file(const std::string& contents,
+                                       char delimiter, size_t chunk_size)
+    {
+        auto path = (std::filesystem::temp_directory_path()
+                     / "argos_test_delimited.txt").string();
+        std::ofstream(path, std::ios::binary) << contents;
+        auto fd = ARGOS_OPEN_FILE(path.c_str());
+        REQUIRE(fd != -1);
+        argos::DelimitedArgumentSource source(fd, delimiter, chunk_size);
+        auto result = read_all(source);
+        ARGOS_CLOSE_FILE(fd);
+        std::remove(path.c_str());
+        return result;
+    }
+
+    std::vector<std::string> read_remaining(argos::ArgumentIterator& it)
+    {
+        std::vector<std::string> result;
+        while (true)
+        {
+            auto batch = it.remaining_arguments();
+            if (batch.empty())
+                return result;
+            result.insert(result.end(), batch.begin(), batch.end());
+        }
+    }
+
+    std::vector<std::string>
+    iterate(argos::ArgumentIterator& it, size_t max_count = SIZE_MAX)
+    {
+        std::vector<std::string> result;
+        std::unique_ptr<argos::IArgumentView> arg;
+        std::string_view value;
+        while (result.size() < max_count && it.next(arg, value))
+        {
+            std::string name = "?";
+            if (auto a = dynamic_cast<const argos::ArgumentView*>(arg.get()))
+                name = a->name();
+            else if (auto o = dynamic_cast<const argos::OptionView*>(arg.get()))
+                name = o->flags().front();
+            result.push_back(name + "=" + std::string(value));
+        }
+        return result;
+    }
+}
+
+TEST_CASE("DelimitedArgumentSource splits on the delimiter")
+{
+    using V = std::vector<std::string>;
+    using namespace std::string_literals;
+    for (size_t chunk_size : {1, 3, 7, 1000})
+    {
+        CAPTURE(chunk_size);
+        REQUIRE(read_file("", '\0', chunk_size).empty());
+        REQUIRE(read_file("abc\0de\0\0f\0"s, '\0', chunk_size)
+                == V{"abc", "de", "", "f"});
+        REQUIRE(read_file("abc\nde\nfghijklmnop", '\n', chunk_size)
+                == V{"abc", "de", "fghijklmnop"});
+    }
+}
+
+TEST_CASE("ArgumentIterator with an argument source")
+{
+    using namespace argos;
+    using V = std::vector<std::string>;
+    ArgumentParser parser("test");
+    parser.auto_exit(false)
+        .add(Argument("FILE").count(1, UINT_MAX))
+        .add(Option{"-a"})
+        .add(Option{"-b"})
+        .add(Option{"-n", "--name"}.argument("NAME"))
+        .add(Option{"--"}.type(OptionType::LAST_OPTION));
+    const auto& const_parser = parser;
+    V args{"f1", "-ab", "-nfoo", "f2", "--name", "bar", "f3", "-n",
+           "baz", "--", "-a", "f4"};
+    V expected{"FILE=f1", "-a=", "-b=", "-n=foo", "FILE=f2", "-n=bar",
+               "FILE=f3", "-n=baz", "--=", "FILE=-a", "FILE=f4"};
+
+    for (size_t batch_size = 1; batch_size <= args.size(); ++batch_size)
+    {
+        CAPTURE(batch_size);
+        auto it = const_parser.make_iterator(
+            std::make_unique<TestSource>(args, batch_size));
+        REQUIRE(iterate(it) == expected);
+        auto parsed = it.parsed_arguments();
+        REQUIRE(parsed.result_code() == ParserResultCode::SUCCESS);
+        REQUIRE(parsed.value("--name").as_string() == "baz");
+        REQUIRE(!parsed.has("FILE"));
+    }
+}
+
+TEST_CASE("ArgumentIterator with an argument source and deferred arguments")
+{
+    using namespace argos;
+    using V = std::vector<std::string>;
+    ArgumentParser parser("test");
+    parser.auto_exit(false)
+        .add(Argument("FILE").count(1, UINT_MAX))
+        .add(Argument("DEST"));
+    const auto& const_parser = parser;
+    V args{"f1", "f2", "f3", "dest"};
+    for (size_t batch_size = 1; batch_size <= args.size(); ++batch_size)
+    {
+        CAPTURE(batch_size);
+        auto it = const_parser.make_iterator(
+            std::make_unique<TestSource>(args, batch_size));
+        REQUIRE(iterate(it)
+                == V{"FILE=f1", "FILE=f2", "FILE=f3", "DEST=dest"});
+    }
+}
+
+TEST_CASE("ArgumentIterator with an argument source stops at STOP option")
+{
+    using namespace argos;
+    ArgumentParser parser("test");
+    parser.auto_exit(false)
+        .add(Argument("FILE").count(0, UINT_MAX))
+        .add(Option{"--stop"}.type(OptionType::STOP));
+    const auto& const_parser = parser;
+    std::vector<std::string> args{"f1", "--stop", "f2", "-x", "f3", "f4"};
+    for (size_t batch_size = 1; batch_size <= args.size(); ++batch_size)
+    {
+        CAPTURE(batch_size);
+        auto it = const_parser.make_iterator(
+            std::make_unique<TestSource>(args, batch_size));
+        REQUIRE(iterate(it) == std::vector<std::string>{"FILE=f1",
+                                                        "--stop="});
+        REQUIRE(it.parsed_arguments().unprocessed_arguments().empty());
+        REQUIRE(read_remaining(it)
+                == std::vector<std::string>{"f2", "-x", "f3", "f4"});
+        REQUIRE(it.remaining_arguments().empty());
+    }
+}
+
+TEST_CASE("ArgumentIterator with an argument source leaves the rest after errors")
+{
+    using namespace argos;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Argument("FILE").count(0, UINT_MAX))
+        .move();
+    std::vector<std::string> args{"f1", "-x", "f2", "f3", "f4", "f5"};
+    auto it = parser.make_iterator(std::make_unique<TestSource>(args, 3));
+    REQUIRE_THROWS(it.remaining_arguments());
+    REQUIRE(iterate(it) == std::vector<std::string>{"FILE=f1"});
+    auto parsed = it.parsed_arguments();
+    REQUIRE(parsed.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(parsed.unprocessed_arguments().empty());
+    REQUIRE(read_remaining(it)
+            == std::vector<std::string>{"f2", "f3", "f4", "f5"});
+}
@@ -0,0 +1,130 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <memory>
+#include "Argos/FlagIndex.hpp"
+#include "Argos/OptionData.hpp"
+#include "Argos/StringUtilities.hpp"
+
+namespace
+{
+    using Flags = std::vector<std::pair<std::string_view, const argos::OptionData*>>;
+
+    std::string fold(std::string_view str, bool ci)
+    {
+        std::string result(str);
+        for (auto& c : result)
+        {
+            if (ci && 'A' <= c && c <= 'Z')
+                c = char(c + ('a' - 'A'));
+        }
+        return result;
+    }
+
+    // The lookup FlagIndex replaced: binary search in a sorted table.
+    const argos::OptionData* find_in_table(const Flags& flags,
+                                           std::string_view arg,
+                                           bool abbreviations, bool ci)
+    {
+        std::vector<std::pair<std::string, const argos::OptionData*>> table;
+        for (auto& [flag, option] : flags)
+            table.emplace_back(fold(flag, ci), option);
+        std::sort(table.begin(), table.end());
+        auto key = fold(arg, ci);
+        auto it = std::lower_bound(
+            table.begin(), table.end(), key,
+            [&](auto& a, auto& b) {return a.first < b;});
+        if (it == table.end())
+            return nullptr;
+        if (it->first == key)
+            return it->second;
+        if (!abbreviations || !argos::starts_with(it->first, key))
+            return nullptr;
+        auto nxt = std::next(it);
+        if (nxt != table.end() && argos::starts_with(nxt->first, key))
+            return nullptr;
+        return it->second;
+    }
+
+    const argos::OptionData* find(const argos::FlagIndex& index,
+                                  std::string_view arg, bool abbreviations)
+    {
+        if (auto option = index.find(arg))
+            return option;
+        return abbreviations ? index.find_abbreviated(arg) : nullptr;
+    }
+}
+
+TEST_CASE("FlagIndex exact and abbreviated lookup")
+{
+    using namespace argos;
+    std::vector<std::unique_ptr<OptionData>> options;
+    std::vector<std::string> strings = {
+        "-a", "-B", "--all", "--allow", "--Alpha-beta", "--alpha-gamma",
+        "--b", "--bold", "--verbose", "--version", "--\xC3\xA6rlig", "--z="
+    };
+    Flags flags;
+    for (auto& s : strings)
+    {
+        options.push_back(std::make_unique<OptionData>());
+        flags.emplace_back(s, options.back().get());
+    }
+
+    std::vector<std::string> args = {
+        "-a", "-A", "-b", "-B", "--a", "--al", "--all", "--ALL", "--allo",
+        "--alp", "--alpha-", "--alpha-b", "--ALPHA-G", "--b", "--bo", "--v",
+        "--verb", "--vers", "--versions", "--\xC3", "--\xC3\xA6", "--z",
+        "--q", "-", "--", "--alpha-betas"
+    };
+
+    for (bool ci : {false, true})
+    {
+        FlagIndex index(flags, ci);
+        for (bool abbreviations : {false, true})
+        {
+            for (auto& arg : args)
+            {
+                CAPTURE(ci, abbreviations, arg);
+                REQUIRE(find(index, arg, abbreviations)
+                        == find_in_table(flags, arg, abbreviations, ci));
+            }
+        }
+    }
+}
+
+TEST_CASE("FlagIndex with many flags")
+{
+    using namespace argos;
+    std::vector<std::unique_ptr<OptionData>> options;
+    std::vector<std::string> strings;
+    for (int i = 0; i < 1000; ++i)
+        strings.push_back("--flag" + std::to_string(i * 37 % 1009));
+    Flags flags;
+    for (auto& s : strings)
+    {
+        options.push_back(std::make_unique<OptionData>());
+        flags.emplace_back(s, options.back().get());
+    }
+
+    FlagIndex index(flags, false);
+    for (size_t i = 0; i < strings.size(); ++i)
+        REQUIRE(index.find(strings[i]) == options[i].get());
+    REQUIRE(index.find("--flag") == nullptr);
+    REQUIRE(index.find("--flag1010") == nullptr);
+    REQUIRE(index.find_abbreviated("--flag100") == nullptr);
+    REQUIRE(index.find_abbreviated("--flag1008")
+            == find_in_table(flags, "--flag1008", true, false));
+}
+
+TEST_CASE("Empty FlagIndex")
+{
+    argos::FlagIndex index;
+    REQUIRE(index.find("--a") == nullptr);
+    REQUIRE(index.find_abbreviated("--a") == nullptr);
+}
@@ -79,3 +79,65 @@ OPTIONS
   --opt Option
 )-");
 }
+
+TEST_CASE("Help text from cacheable callbacks is only formatted once.")
+{
+    using namespace argos;
+    std::stringstream ss;
+    int calls = 0;
+    const auto parser = ArgumentParser("prog")
+        .add(Opt({"--opt"}).help([&]{++calls; return "Option";},
+                                 TextCallbackMode::CACHEABLE))
+        .text(TextId::ABOUT, [&]{++calls; return "About prog.";},
+              TextCallbackMode::CACHEABLE)
+        .generate_help_option(false)
+        .line_width(80)
+        .stream(&ss)
+        .move();
+    parser.write_help_text();
+    auto text = ss.str();
+    REQUIRE(calls == 2);
+    ss.str("");
+    parser.write_help_text();
+    REQUIRE(calls == 2);
+    REQUIRE(ss.str() == text);
+    REQUIRE(text == R"-(USAGE
+  prog [--opt]
+
+About prog.
+
+OPTIONS
+  --opt Option
+)-");
+}
+
+TEST_CASE("Help text from dynamic callbacks is formatted every time.")
+{
+    using namespace argos;
+    std::stringstream ss;
+    int calls = 0;
+    const auto parser = ArgumentParser("prog")
+        .add(Opt({"--opt"}).help([&]{return "Call " + std::to_string(++calls);}))
+        .add(Opt({"--other"}).help([]{return "Other";},
+                                   TextCallbackMode::CACHEABLE))
+        .generate_help_option(false)
+        .line_width(80)
+        .stream(&ss)
+        .move();
+    parser.write_help_text();
+    parser.write_help_text();
+    REQUIRE(calls == 2);
+    REQUIRE(ss.str() == R"-(USAGE
+  prog [--opt] [--other]
+
+OPTIONS
+  --opt   Call 1
+  --other Other
+USAGE
+  prog [--opt] [--other]
+
+OPTIONS
+  --opt   Call 2
+  --other Other
+)-");
+}
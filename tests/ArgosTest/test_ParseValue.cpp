@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Argos/ParseValue.hpp"
+#include <cstdint>
 #include <catch2/catch_test_macros.hpp>
 
 TEST_CASE("parse_integer on empty string")
@@ -17,3 +18,67 @@ TEST_CASE("parse_floating_point on empty string")
 {
     REQUIRE(!argos::parse_floating_point<double>({}).has_value());
 }
+
+TEST_CASE("parse_integer with different bases")
+{
+    using argos::parse_integer;
+    REQUIRE(parse_integer<int>("123", 10) == 123);
+    REQUIRE(parse_integer<int>("-123", 10) == -123);
+    REQUIRE(parse_integer<int>("+123", 10) == 123);
+    REQUIRE(parse_integer<int>(" 12", 10) == 12);
+    REQUIRE(parse_integer<int>("0x1F", 0) == 31);
+    REQUIRE(parse_integer<int>("-0X1f", 0) == -31);
+    REQUIRE(parse_integer<int>("017", 0) == 15);
+    REQUIRE(parse_integer<int>("0", 0) == 0);
+    REQUIRE(parse_integer<int>("0x1F", 16) == 31);
+    REQUIRE(parse_integer<int>("1F", 16) == 31);
+    REQUIRE(parse_integer<int>("zz", 36) == 35 * 36 + 35);
+    REQUIRE(parse_integer<int>("101", 2) == 5);
+    REQUIRE(!parse_integer<int>("102", 2));
+    REQUIRE(!parse_integer<int>("0x", 0));
+    REQUIRE(!parse_integer<int>("12 ", 10));
+    REQUIRE(!parse_integer<int>("1a", 10));
+    REQUIRE(!parse_integer<int>("+-1", 10));
+    REQUIRE(!parse_integer<int>("-", 10));
+    REQUIRE(!parse_integer<int>("1", 1));
+    REQUIRE(!parse_integer<int>("1", 37));
+}
+
+TEST_CASE("parse_integer detects overflow exactly")
+{
+    using argos::parse_integer;
+    REQUIRE(parse_integer<int>("2147483647", 10) == 2147483647);
+    REQUIRE(!parse_integer<int>("2147483648", 10));
+    REQUIRE(parse_integer<int>("-2147483648", 10) == INT32_MIN);
+    REQUIRE(!parse_integer<int>("-2147483649", 10));
+    REQUIRE(parse_integer<long long>("-9223372036854775808", 10)
+            == INT64_MIN);
+    REQUIRE(!parse_integer<long long>("9223372036854775808", 10));
+    REQUIRE(parse_integer<unsigned>("4294967295", 10) == 4294967295u);
+    REQUIRE(!parse_integer<unsigned>("4294967296", 10));
+    REQUIRE(parse_integer<unsigned long long>("0xFFFFFFFFFFFFFFFF", 0)
+            == UINT64_MAX);
+    REQUIRE(!parse_integer<unsigned long long>("0x10000000000000000", 0));
+    REQUIRE(!parse_integer<unsigned>("-1", 10));
+    REQUIRE(parse_integer<unsigned>("-0", 10) == 0u);
+}
+
+TEST_CASE("parse_floating_point")
+{
+    using argos::parse_floating_point;
+    REQUIRE(parse_floating_point<double>("1.5") == 1.5);
+    REQUIRE(parse_floating_point<double>("-1.5e3") == -1500.0);
+    REQUIRE(parse_floating_point<double>("+.25") == 0.25);
+    REQUIRE(parse_floating_point<double>(" 2") == 2.0);
+    REQUIRE(parse_floating_point<double>("0x1.8p1") == 3.0);
+    REQUIRE(parse_floating_point<double>("-0X10") == -16.0);
+    REQUIRE(parse_floating_point<float>("0.5") == 0.5f);
+    REQUIRE(*parse_floating_point<double>("-inf") < 0);
+    REQUIRE(!parse_floating_point<double>("1.5 "));
+    REQUIRE(!parse_floating_point<double>("1,5"));
+    REQUIRE(!parse_floating_point<double>("1e"));
+    REQUIRE(!parse_floating_point<double>("+-1"));
+    REQUIRE(!parse_floating_point<double>("0x-1"));
+    REQUIRE(!parse_floating_point<double>("1e400"));
+    REQUIRE(!parse_floating_point<float>("1e40"));
+}
@@ -5,6 +5,7 @@
 // This file is distributed under the BSD License.
 // License text is included with the source distribution.
 //****************************************************************************
+#include <thread>
 #include <catch2/catch_test_macros.hpp>
 #include "Argos/Argos.hpp"
 
@@ -45,3 +46,127 @@ TEST_CASE("Test filter argc/argv")
         REQUIRE(std::string(v[3]) == "text");
     }
 }
+
+TEST_CASE("Many values of varying length")
+{
+    using namespace argos;
+    auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Argument("FILE").count(1, 10000))
+        .move();
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 3000; ++i)
+        strings.push_back(std::string(i % 300, char('a' + i % 26)));
+    strings.push_back(std::string(100000, 'x'));
+    strings.emplace_back("last");
+    std::vector<std::string_view> argv(strings.begin(), strings.end());
+    auto args = parser.parse(argv);
+    auto values = args.values("FILE").raw_values();
+    REQUIRE(values.size() == strings.size());
+    for (size_t i = 0; i < strings.size(); ++i)
+        REQUIRE(values[i] == strings[i]);
+}
+
+TEST_CASE("Assign, append and clear values")
+{
+    using namespace argos;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Option{"-a"}.argument("A").operation(OptionOperation::APPEND)
+                 .alias("V"))
+        .add(Option{"-s"}.argument("S").alias("V"))
+        .add(Option{"-c"}.operation(OptionOperation::CLEAR).alias("V"))
+        .move();
+    auto args = parser.parse({"-a", "1", "-a", "2", "-a", "3"});
+    REQUIRE(args.values("V").raw_values()
+            == std::vector<std::string_view>{"1", "2", "3"});
+    REQUIRE_THROWS(args.value("V"));
+
+    args = parser.parse({"-a", "1", "-a", "2", "-s", "3", "-a", "4"});
+    REQUIRE(args.values("V").raw_values()
+            == std::vector<std::string_view>{"3", "4"});
+
+    args = parser.parse({"-a", "1", "-a", "2", "-c"});
+    REQUIRE(!args.has("V"));
+    REQUIRE(args.values("V").empty());
+}
+
+TEST_CASE("Retrieve values with value handles")
+{
+    using namespace argos;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Argument("FILE").count(0, 10))
+        .add(Option{"-v", "--verbose"})
+        .add(Option{"-n", "--number"}.argument("N"))
+        .move();
+    const auto file = parser.value_handle("FILE");
+    const auto verbose = parser.value_handle("--verbose");
+    const auto number = parser.value_handle("-n");
+    REQUIRE(verbose);
+    REQUIRE(verbose.value_id() == parser.value_handle("-v").value_id());
+    REQUIRE(number.value_id() != verbose.value_id());
+
+    auto args1 = parser.parse({"-v", "-n", "12", "a", "b"});
+    REQUIRE(args1.has(verbose));
+    REQUIRE(args1.value(number).as_int() == 12);
+    REQUIRE(args1.values(file).as_strings()
+            == std::vector<std::string>{"a", "b"});
+
+    auto args2 = parser.parse({"c"});
+    REQUIRE(!args2.has(verbose));
+    REQUIRE(!args2.value(number));
+    REQUIRE(args2.values(file).as_strings() == std::vector<std::string>{"c"});
+    REQUIRE(args2.value_handle("FILE").value_id() == file.value_id());
+
+    REQUIRE_THROWS(parser.value_handle("--size"));
+    REQUIRE_THROWS(args1.value(ValueHandle()));
+    REQUIRE_THROWS(args1.has(ValueHandle(ValueId(1000),
+                                         verbose.generation())));
+}
+
+TEST_CASE("Value handles only work with their own parser")
+{
+    using namespace argos;
+    auto make_parser = []
+    {
+        return ArgumentParser("test")
+            .auto_exit(false)
+            .add(Option{"-v", "--verbose"})
+            .move();
+    };
+    const auto parser1 = make_parser();
+    const auto parser2 = make_parser();
+    const auto verbose = parser1.value_handle("-v");
+    REQUIRE(parser1.parse({"-v"}).has(verbose));
+    REQUIRE(parser1.parse_batch({{"-v"}})[0].has(verbose));
+    REQUIRE_THROWS(parser2.parse({"-v"}).has(verbose));
+
+    auto parser3 = make_parser();
+    const auto handle = parser3.value_handle("-v");
+    parser3.add(Option{"-q"});
+    REQUIRE_THROWS(parser3.parse({"-v"}).has(handle));
+}
+
+TEST_CASE("ParsedArguments can be read from several threads")
+{
+    using namespace argos;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .ignore_undefined_arguments(true)
+        .add(Option{"-v"})
+        .move();
+    const auto args = parser.parse({"-v", "a", "b"});
+    std::vector<size_t> sizes(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < sizes.size(); ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            sizes[i] = args.unprocessed_arguments().size();
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    REQUIRE(sizes == std::vector<size_t>(4, 2));
+}
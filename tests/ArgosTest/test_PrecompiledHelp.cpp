@@ -0,0 +1,82 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include "Argos/ArgumentParser.hpp"
+#include "Argos/HelpText.hpp"
+
+namespace
+{
+    constexpr argos::PrecompiledHelpText TEXTS[] = {
+        {"prog", 60, "help 60", "usage 60"},
+        {"prog", 80, "help 80", "usage 80"},
+        {"prog cmd", 80, "cmd help 80", "cmd usage 80"},
+        {"prog", 100, "help 100", "usage 100"}
+    };
+
+    std::string_view find_help(std::string_view program_name, unsigned width)
+    {
+        auto text = argos::find_precompiled_help_text(program_name, width);
+        return text ? text->help_text : "NONE";
+    }
+}
+
+TEST_CASE("Find precompiled help texts")
+{
+    using namespace argos;
+    set_precompiled_help_texts(TEXTS);
+    CHECK(find_help("prog", 80) == "help 80");
+    CHECK(find_help("prog", 99) == "help 80");
+    CHECK(find_help("prog", 200) == "help 100");
+    CHECK(find_help("prog", 40) == "help 60");
+    CHECK(find_help("prog cmd", 120) == "cmd help 80");
+    CHECK(find_help("renamed", 70) == "help 60");
+    CHECK(find_help("prog other", 70) == "NONE");
+    set_precompiled_help_texts(nullptr, 0);
+    CHECK(find_help("prog", 80) == "NONE");
+}
+
+TEST_CASE("Write precompiled help header")
+{
+    using namespace argos;
+    const auto parser = ArgumentParser("prog")
+        .about("Says \"hello\" to C:\\.")
+        .add(Argument("file"))
+        .move();
+    auto data = get_finalized_data(parser);
+    std::stringstream ss;
+    write_precompiled_help_header({data.get()}, {40}, ss);
+    REQUIRE(ss.str() == R"-(// Generated by Argos from the program's parser definitions. Do not edit.
+#pragma once
+#include <Argos/PrecompiledHelp.hpp>
+
+namespace argos_precompiled_help
+{
+    inline constexpr argos::PrecompiledHelpText TEXTS[] = {
+        {"prog", 40,
+            "USAGE\n"
+            "  prog --help\n"
+            "  prog <file>\n"
+            "\n"
+            "Says \"hello\" to C:\\.\n"
+            "\n"
+            "ARGUMENTS\n"
+            "  <file>\n"
+            "\n"
+            "OPTIONS\n"
+            "  -h, --help Display the help text.\n",
+            "USAGE\n"
+            "  prog --help\n"
+            "  prog <file>\n"},
+    };
+
+    inline const bool IS_REGISTERED =
+        argos::set_precompiled_help_texts(TEXTS);
+}
+)-");
+}
@@ -0,0 +1,107 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <catch2/catch_test_macros.hpp>
+#include "Argos/Argos.hpp"
+#include "Argos/ResponseFiles.hpp"
+
+namespace
+{
+    std::vector<std::string> tokenize(std::string text)
+    {
+        auto tokens = argos::tokenize_response_file(text.data(), text.size());
+        return {tokens.begin(), tokens.end()};
+    }
+
+    class TempFile
+    {
+    public:
+        TempFile(const std::string& name, const std::string& contents)
+            : m_path((std::filesystem::temp_directory_path()
+                      / ("argos_test_" + name)).string())
+        {
+            std::ofstream(m_path, std::ios::binary) << contents;
+        }
+
+        ~TempFile()
+        {
+            std::filesystem::remove(m_path);
+        }
+
+        std::string arg() const
+        {
+            return "@" + m_path;
+        }
+    private:
+        std::string m_path;
+    };
+}
+
+TEST_CASE("Tokenize response files")
+{
+    using V = std::vector<std::string>;
+    REQUIRE(tokenize("").empty());
+    REQUIRE(tokenize(" \n\t ").empty());
+    REQUIRE(tokenize("abc  def\n\tghi\r\n") == V{"abc", "def", "ghi"});
+    REQUIRE(tokenize(R"("a b" 'c d'e)") == V{"a b", "c de"});
+    REQUIRE(tokenize(R"(a\ b "c\"d" 'e\f')") == V{"a b", "c\"d", "e\\f"});
+    REQUIRE(tokenize(R"("" x'')") == V{"", "x"});
+    REQUIRE(tokenize(R"("unterminated quote)") == V{"unterminated quote"});
+    REQUIRE(tokenize(std::string("a b\0c\0\0d\0", 9)) == V{"a b", "c", "", "d"});
+}
+
+TEST_CASE("Expand response files")
+{
+    using namespace argos;
+    TempFile inner("inner.rsp", "--name 'inner value' file3\n");
+    TempFile outer("outer.rsp", "-v file1\n" + inner.arg() + "\nfile2\n");
+    auto args = ArgumentParser("test")
+        .auto_exit(false)
+        .expand_response_files(true)
+        .add(Argument("FILE").count(1, 10))
+        .add(Option{"-v"})
+        .add(Option{"--name"}.argument("NAME"))
+        .parse({outer.arg(), "file4", "@does/not/exist"});
+    REQUIRE(args.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(args.value("-v").as_bool());
+    REQUIRE(args.value("--name").as_string() == "inner value");
+    REQUIRE(args.values("FILE").as_strings()
+            == std::vector<std::string>{"file1", "file3", "file2", "file4",
+                                        "@does/not/exist"});
+}
+
+TEST_CASE("Response files are not expanded by default")
+{
+    using namespace argos;
+    TempFile file("default.rsp", "file1");
+    auto args = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Argument("FILE"))
+        .parse({file.arg()});
+    REQUIRE(args.value("FILE").as_string() == file.arg());
+}
+
+TEST_CASE("Response file that includes itself")
+{
+    using namespace argos;
+    auto name = (std::filesystem::temp_directory_path()
+                 / "argos_test_cycle2.rsp").string();
+    TempFile file1("cycle1.rsp", "a @" + name);
+    TempFile file2("cycle2.rsp", "b " + file1.arg());
+    std::stringstream ss;
+    auto args = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .expand_response_files(true)
+        .add(Argument("FILE").count(0, 10))
+        .parse({file1.arg()});
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(args.error_message().find("includes itself") != std::string::npos);
+}
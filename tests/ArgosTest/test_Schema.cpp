@@ -0,0 +1,144 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <sstream>
+#include <thread>
+#include <catch2/catch_test_macros.hpp>
+#include "Argos/Argos.hpp"
+
+namespace
+{
+    enum class Level
+    {
+        LOW,
+        HIGH
+    };
+
+    struct Config
+    {
+        int jobs = 1;
+        double ratio = 0.5;
+        bool verbose = false;
+        std::string output = "a.out";
+        std::vector<std::string> defines;
+        Level level = Level::LOW;
+        std::vector<std::string> files;
+    };
+
+    argos::Schema<Config> make_schema(std::ostream& stream)
+    {
+        using namespace argos;
+        Schema<Config> schema(ArgumentParser("test")
+                                  .auto_exit(false)
+                                  .stream(&stream)
+                                  .move());
+        schema.field(&Config::files, Argument("FILE").count(0, 10))
+            .field(&Config::jobs, Option{"-j", "--jobs"}.argument("N"))
+            .field(&Config::ratio, Option{"--ratio"}.argument("R"))
+            .field(&Config::verbose, Option{"-v", "--verbose"})
+            .field(&Config::output, Option{"-o"}.argument("FILE"))
+            .field(&Config::defines, Option{"-D"}.argument("NAME")
+                       .operation(OptionOperation::APPEND))
+            .field(&Config::level, Option{"--level"}.argument("LEVEL"),
+                   {{"low", Level::LOW}, {"high", Level::HIGH}});
+        return schema;
+    }
+}
+
+TEST_CASE("Schema assigns values to members")
+{
+    std::stringstream ss;
+    const auto schema = make_schema(ss);
+    auto config = schema.parse({"-j", "8", "--ratio", "0.25", "-v",
+                                "-o", "b.out", "-D", "X", "-D", "Y",
+                                "--level", "high", "f1", "f2"});
+    REQUIRE(config.jobs == 8);
+    REQUIRE(config.ratio == 0.25);
+    REQUIRE(config.verbose);
+    REQUIRE(config.output == "b.out");
+    REQUIRE(config.defines == std::vector<std::string>{"X", "Y"});
+    REQUIRE(config.level == Level::HIGH);
+    REQUIRE(config.files == std::vector<std::string>{"f1", "f2"});
+}
+
+TEST_CASE("Schema keeps the values of members that aren't given")
+{
+    std::stringstream ss;
+    const auto schema = make_schema(ss);
+    Config config;
+    config.jobs = 4;
+    auto args = schema.parse({"-v"}, config);
+    REQUIRE(args.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(args.has("-v"));
+    REQUIRE_FALSE(args.has("--jobs"));
+    REQUIRE(config.jobs == 4);
+    REQUIRE(config.verbose);
+    REQUIRE(config.output == "a.out");
+}
+
+TEST_CASE("Schema reports values that can't be converted")
+{
+    std::stringstream ss;
+    const auto schema = make_schema(ss);
+    Config config;
+    auto args = schema.parse({"-j", "many"}, config);
+    REQUIRE(args.result_code() == argos::ParserResultCode::FAILURE);
+    REQUIRE(config.jobs == 1);
+    REQUIRE(ss.str().find("many") != std::string::npos);
+}
+
+TEST_CASE("Schema parse_all returns one object per command line")
+{
+    std::stringstream ss;
+    const auto schema = make_schema(ss);
+    std::vector<argos::ParserResultCode> codes;
+    auto configs = schema.parse_all({{"-j", "2"},
+                                     {"--level", "medium"},
+                                     {"-D", "Z", "file"}},
+                                    &codes);
+    REQUIRE(configs.size() == 3);
+    REQUIRE(configs[0].jobs == 2);
+    REQUIRE(configs[1].jobs == 1);
+    REQUIRE(configs[2].defines == std::vector<std::string>{"Z"});
+    REQUIRE(configs[2].files == std::vector<std::string>{"file"});
+    REQUIRE(codes == std::vector<argos::ParserResultCode>{
+        argos::ParserResultCode::SUCCESS,
+        argos::ParserResultCode::FAILURE,
+        argos::ParserResultCode::SUCCESS});
+}
+
+TEST_CASE("Schema can be used from several threads")
+{
+    std::stringstream ss;
+    const auto schema = make_schema(ss);
+    std::vector<Config> configs(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < configs.size(); ++i)
+    {
+        threads.emplace_back([&, i]
+        {
+            auto jobs = std::to_string(i);
+            for (int j = 0; j < 100; ++j)
+                configs[i] = schema.parse({"-j", jobs, "-D", jobs});
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (size_t i = 0; i < configs.size(); ++i)
+    {
+        REQUIRE(configs[i].jobs == int(i));
+        REQUIRE(configs[i].defines.size() == 1);
+    }
+}
+
+TEST_CASE("Schema fields can't be assigned by the parser directly")
+{
+    std::stringstream ss;
+    const auto schema = make_schema(ss);
+    REQUIRE_THROWS_AS(schema.parser().parse({"-j", "2"}),
+                      argos::ArgosException);
+}
@@ -51,3 +51,117 @@ TEST_CASE("Test find_nth_code_point non-UTF8")
 {
     REQUIRE(argos::find_nth_code_point("Ba boo\200 boo ma.", 8) == 8);
 }
+
+namespace
+{
+    // Byte-by-byte versions of count_code_points and find_nth_code_point.
+    size_t get_length(char c)
+    {
+        auto u = unsigned(static_cast<uint8_t>(c));
+        if (u < 0x80)
+            return 1;
+        if (u < 0xC0 || u > 0xF7)
+            return 0;
+        return u < 0xE0 ? 2 : u < 0xF0 ? 3 : 4;
+    }
+
+    size_t reference_count(std::string_view str)
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < str.size(); ++count)
+        {
+            auto len = get_length(str[i]);
+            if (len == 0)
+                return str.size();
+            for (size_t j = 1; j < len && i + j < str.size(); ++j)
+            {
+                if ((uint8_t(str[i + j]) & 0xC0u) != 0x80u)
+                    return str.size();
+            }
+            i += len;
+        }
+        return count;
+    }
+
+    size_t reference_find(std::string_view str, size_t n)
+    {
+        if (n >= str.size())
+            return std::string_view::npos;
+        size_t count = 0;
+        for (size_t i = 0; i < str.size(); ++count)
+        {
+            if (count == n)
+                return i;
+            auto len = get_length(str[i]);
+            if (len == 0)
+                return n;
+            for (size_t j = 1; j < len; ++j)
+            {
+                if (i + j == str.size())
+                    return n;
+                if ((uint8_t(str[i + j]) & 0xC0u) != 0x80u)
+                    return n;
+            }
+            i += len;
+        }
+        return std::string_view::npos;
+    }
+
+    std::string make_text(unsigned seed, size_t size)
+    {
+        const char* const PIECES[] = {
+            "a", "bcd ", "efghijklmnop", "\xC3\xA6", "\xE3\x81\x82",
+            "\xF0\x9F\x98\x80", "qrstuvwxyz0123456789"
+        };
+        std::string result;
+        while (result.size() < size)
+        {
+            seed = seed * 1103515245u + 12345u;
+            result += PIECES[(seed >> 16) % 7];
+        }
+        return result;
+    }
+}
+
+TEST_CASE("count_code_points and find_nth_code_point on long strings")
+{
+    for (unsigned seed = 0; seed < 20; ++seed)
+    {
+        auto text = make_text(seed, 150);
+        CAPTURE(seed);
+        for (size_t size = 0; size <= text.size(); ++size)
+        {
+            std::string_view str(text.data(), size);
+            CAPTURE(size);
+            REQUIRE(argos::count_code_points(str) == reference_count(str));
+            for (size_t n = 0; n <= size; n += 7)
+            {
+                CAPTURE(n);
+                REQUIRE(argos::find_nth_code_point(str, n)
+                        == reference_find(str, n));
+            }
+        }
+    }
+}
+
+TEST_CASE("count_code_points and find_nth_code_point with invalid bytes")
+{
+    const char INVALID[] = {'\x80', '\xBF', '\xF8', '\xFF', '\xC3', '\xE3'};
+    const auto text = make_text(1, 100);
+    for (size_t pos = 0; pos < text.size(); pos += 3)
+    {
+        for (char c : INVALID)
+        {
+            auto str = text;
+            str[pos] = c;
+            CAPTURE(pos, int(uint8_t(c)));
+            REQUIRE(argos::count_code_points(str) == reference_count(str));
+            for (size_t n = 0; n <= str.size(); n += 5)
+            {
+                CAPTURE(n);
+                REQUIRE(argos::find_nth_code_point(str, n)
+                        == reference_find(str, n));
+            }
+        }
+    }
+}
@@ -0,0 +1,210 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-17.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <sstream>
+#include <catch2/catch_test_macros.hpp>
+#include "Argos/Argos.hpp"
+
+namespace
+{
+    struct Factories
+    {
+        int commit_count = 0;
+        int push_count = 0;
+        std::stringstream ss;
+
+        argos::ArgumentParser make_parser(bool case_insensitive = false)
+        {
+            using namespace argos;
+            return ArgumentParser("git")
+                .auto_exit(false)
+                .stream(&ss)
+                .case_insensitive(case_insensitive)
+                .add(Option{"-C"}.argument("DIR"))
+                .add(Subcommand("commit", [this]
+                {
+                    ++commit_count;
+                    return ArgumentParser("commit")
+                        .auto_exit(false)
+                        .stream(&ss)
+                        .add(Option{"-m", "--message"}.argument("MSG")
+                                 .optional(false))
+                        .add(Argument("FILE").optional(true).count(0, 10))
+                        .move();
+                }).help("Record changes to the repository."))
+                .add(Subcommand("push", [this]
+                {
+                    ++push_count;
+                    return ArgumentParser("push")
+                        .auto_exit(false)
+                        .stream(&ss)
+                        .add(Argument("REMOTE"))
+                        .move();
+                }).help("Update remote refs."))
+                .move();
+        }
+    };
+}
+
+TEST_CASE("Only the selected subcommand is created")
+{
+    Factories f;
+    auto args = f.make_parser().parse({"-C", "dir", "commit", "-m", "msg",
+                                       "a.cpp", "b.cpp"});
+    REQUIRE(args.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(f.commit_count == 1);
+    REQUIRE(f.push_count == 0);
+    REQUIRE(args.value("-C").as_string() == "dir");
+    REQUIRE(args.subcommand() == "commit");
+    const auto& sub = args.subcommand_arguments();
+    REQUIRE(sub.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(sub.value("--message").as_string() == "msg");
+    REQUIRE(sub.values("FILE").as_strings()
+            == std::vector<std::string>{"a.cpp", "b.cpp"});
+}
+
+TEST_CASE("Subcommand from a command line")
+{
+    Factories f;
+    const auto parser = f.make_parser();
+    auto args = parser.parse_command_line("push 'my remote'");
+    REQUIRE(args.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(args.subcommand() == "push");
+    REQUIRE(args.subcommand_arguments().value("REMOTE").as_string()
+            == "my remote");
+    REQUIRE(f.push_count == 1);
+    REQUIRE(f.commit_count == 0);
+}
+
+TEST_CASE("Subcommand errors")
+{
+    using namespace argos;
+    Factories f;
+    const auto parser = f.make_parser();
+
+    auto args = parser.parse({"pull"});
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(args.error_message() == "Unknown command: pull");
+    REQUIRE(args.subcommand().empty());
+    REQUIRE_THROWS(args.subcommand_arguments());
+
+    args = parser.parse({"-C", "dir"});
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(args.error_message() == "No command given.");
+
+    f.ss.str({});
+    args = parser.parse({"commit", "a.cpp"});
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(args.subcommand() == "commit");
+    REQUIRE(args.error_message()
+            == args.subcommand_arguments().error_message());
+    REQUIRE(f.ss.str().find("git commit: ") == 0);
+    REQUIRE(f.commit_count == 1);
+    REQUIRE(f.push_count == 0);
+}
+
+TEST_CASE("Subcommand help")
+{
+    using namespace argos;
+    Factories f;
+    const auto parser = f.make_parser();
+
+    auto args = parser.parse({"--help"});
+    REQUIRE(args.result_code() == ParserResultCode::STOP);
+    auto help = f.ss.str();
+    REQUIRE(help.find("git [-C <DIR>] <command> [<arguments>]...") != std::string::npos);
+    REQUIRE(help.find("COMMANDS") != std::string::npos);
+    REQUIRE(help.find("commit") != std::string::npos);
+    REQUIRE(help.find("Update remote refs.") != std::string::npos);
+    REQUIRE(f.commit_count == 0);
+    REQUIRE(f.push_count == 0);
+
+    f.ss.str({});
+    args = parser.parse({"push", "--help"});
+    REQUIRE(args.result_code() == ParserResultCode::STOP);
+    REQUIRE(args.subcommand_arguments().result_code()
+            == ParserResultCode::STOP);
+    REQUIRE(f.ss.str().find("git push <REMOTE>") != std::string::npos);
+}
+
+TEST_CASE("Case-insensitive subcommands")
+{
+    Factories f;
+    auto args = f.make_parser(true).parse({"PUSH", "origin"});
+    REQUIRE(args.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(args.subcommand() == "push");
+}
+
+TEST_CASE("Invalid subcommand definitions")
+{
+    using namespace argos;
+    auto factory = []{return ArgumentParser("sub").move();};
+    REQUIRE_THROWS(ArgumentParser("test").add(Subcommand("", factory)));
+    REQUIRE_THROWS(ArgumentParser("test").add(Subcommand("sub", {})));
+    REQUIRE_THROWS(ArgumentParser("test")
+                       .add(Argument("ARG"))
+                       .add(Subcommand("sub", factory)));
+    REQUIRE_THROWS(ArgumentParser("test")
+                       .add(Subcommand("sub", factory))
+                       .add(Argument("ARG")));
+    REQUIRE_THROWS(ArgumentParser("test")
+                       .auto_exit(false)
+                       .add(Subcommand("sub", factory))
+                       .add(Subcommand("sub", factory))
+                       .parse({"sub"}));
+}
+
+TEST_CASE("Subcommand parsers inherit auto_exit and the stream")
+{
+    using namespace argos;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("git")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Subcommand("push", []
+        {
+            return ArgumentParser("push").add(Argument("REMOTE")).move();
+        }))
+        .move();
+
+    auto args = parser.parse({"push"});
+    REQUIRE(args.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(ss.str().find("git push: ") == 0);
+
+    ss.str({});
+    auto results = parser.parse_batch({{"push"}, {"push", "origin"}});
+    REQUIRE(results[0].result_code() == ParserResultCode::FAILURE);
+    REQUIRE(ss.str().empty());
+    REQUIRE(results[1].result_code() == ParserResultCode::SUCCESS);
+}
+
+TEST_CASE("Subcommand parsers are created once")
+{
+    Factories f;
+    const auto parser = f.make_parser();
+    for (int i = 0; i < 3; ++i)
+    {
+        auto args = parser.parse({"push", "origin"});
+        REQUIRE(args.subcommand_arguments().value("REMOTE").as_string()
+                == "origin");
+    }
+    REQUIRE(f.push_count == 1);
+}
+
+TEST_CASE("Subcommand parsers are created once across batches")
+{
+    Factories f;
+    const auto parser = f.make_parser();
+    for (int i = 0; i < 3; ++i)
+    {
+        auto results = parser.parse_batch({{"push", "origin"},
+                                           {"push", "upstream"}});
+        REQUIRE(results[1].subcommand_arguments().value("REMOTE").as_string()
+                == "upstream");
+    }
+    REQUIRE(f.push_count == 1);
+}
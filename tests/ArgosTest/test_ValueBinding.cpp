@@ -0,0 +1,191 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include <sstream>
+#include <catch2/catch_test_macros.hpp>
+#include "Argos/Argos.hpp"
+
+namespace
+{
+    enum class Mode
+    {
+        NORMAL,
+        FAST,
+        SAFE
+    };
+
+    struct Config
+    {
+        int threads = 1;
+        double ratio = 0.5;
+        bool verbose = false;
+        std::string output = "out.txt";
+        std::vector<std::string> includes = {"default"};
+        Mode mode = Mode::NORMAL;
+        std::vector<unsigned> sizes;
+    };
+
+    argos::ArgumentParser make_parser(Config& config, std::ostream& stream)
+    {
+        using namespace argos;
+        return ArgumentParser("test")
+            .auto_exit(false)
+            .stream(&stream)
+            .add(Argument("SIZE").count(0, 10).bind(&config.sizes))
+            .add(Option{"-j", "--threads"}.argument("N")
+                     .bind(&config.threads))
+            .add(Option{"--ratio"}.argument("R").bind(&config.ratio))
+            .add(Option{"-v", "--verbose"}.bind(&config.verbose))
+            .add(Option{"-o"}.argument("FILE").bind(&config.output))
+            .add(Option{"-I"}.argument("DIR")
+                     .operation(OptionOperation::APPEND)
+                     .bind(&config.includes))
+            .add(Option{"--no-includes"}.alias("-I")
+                     .operation(OptionOperation::CLEAR))
+            .add(Option{"--mode"}.argument("MODE")
+                     .bind(&config.mode, {{"fast", Mode::FAST},
+                                          {"safe", Mode::SAFE}}))
+            .move();
+    }
+}
+
+TEST_CASE("Values are converted and assigned to bound variables")
+{
+    Config config;
+    std::stringstream ss;
+    auto args = make_parser(config, ss).parse(
+        {"-j", "8", "--ratio=0.25", "-v", "-o", "file.txt", "-I", "a",
+         "-I", "b", "--mode", "safe", "10", "20"});
+    REQUIRE(args.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(config.threads == 8);
+    REQUIRE(config.ratio == 0.25);
+    REQUIRE(config.verbose);
+    REQUIRE(config.output == "file.txt");
+    REQUIRE(config.includes == std::vector<std::string>{"a", "b"});
+    REQUIRE(config.mode == Mode::SAFE);
+    REQUIRE(config.sizes == std::vector<unsigned>{10, 20});
+
+    // Only the fact that the values were given is stored.
+    REQUIRE(args.has("--threads"));
+    REQUIRE(args.has("--ratio"));
+    REQUIRE(args.value("--threads").as_string().empty());
+}
+
+TEST_CASE("Bound variables keep their values if not given")
+{
+    Config config;
+    std::stringstream ss;
+    auto args = make_parser(config, ss).parse({"-j", "2"});
+    REQUIRE(args.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(config.threads == 2);
+    REQUIRE(config.ratio == 0.5);
+    REQUIRE(!config.verbose);
+    REQUIRE(config.output == "out.txt");
+    REQUIRE(config.includes == std::vector<std::string>{"default"});
+    REQUIRE(!args.has("-I"));
+}
+
+TEST_CASE("CLEAR option clears bound vector")
+{
+    Config config;
+    std::stringstream ss;
+    const auto parser = make_parser(config, ss);
+    auto args = parser.parse({"--no-includes"});
+    REQUIRE(args.result_code() == argos::ParserResultCode::SUCCESS);
+    REQUIRE(config.includes.empty());
+
+    auto args2 = parser.parse({"-I", "a", "--no-includes", "-I", "b"});
+    REQUIRE(config.includes == std::vector<std::string>{"b"});
+}
+
+TEST_CASE("Invalid values for bound variables are parse errors")
+{
+    Config config;
+    std::stringstream ss;
+    const auto parser = make_parser(config, ss);
+
+    auto args1 = parser.parse({"--threads", "many"});
+    REQUIRE(args1.result_code() == argos::ParserResultCode::FAILURE);
+    REQUIRE(args1.error_message() == "--threads: invalid value \"many\".");
+    REQUIRE(config.threads == 1);
+
+    auto args2 = parser.parse({"--mode", "slow"});
+    REQUIRE(args2.result_code() == argos::ParserResultCode::FAILURE);
+    REQUIRE(config.mode == Mode::NORMAL);
+
+    auto args3 = parser.parse({"10", "1.5"});
+    REQUIRE(args3.result_code() == argos::ParserResultCode::FAILURE);
+    REQUIRE(args3.error_message() == "SIZE: invalid value \"1.5\".");
+}
+
+TEST_CASE("Bound arguments whose count depends on the other arguments")
+{
+    using namespace argos;
+    std::vector<int> numbers;
+    std::string dest;
+    std::stringstream ss;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .stream(&ss)
+        .add(Argument("N").count(1, 10).bind(&numbers))
+        .add(Argument("DEST").bind(&dest))
+        .move();
+
+    auto args1 = parser.parse({"1", "2", "3", "dir"});
+    REQUIRE(args1.result_code() == ParserResultCode::SUCCESS);
+    REQUIRE(numbers == std::vector<int>{1, 2, 3});
+    REQUIRE(dest == "dir");
+
+    auto args2 = parser.parse({"1", "x", "dir"});
+    REQUIRE(args2.result_code() == ParserResultCode::FAILURE);
+    REQUIRE(args2.error_message() == "N: invalid value \"x\".");
+}
+
+TEST_CASE("Initial values are assigned to bound variables")
+{
+    using namespace argos;
+    int level = 0;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Option{"--level"}.argument("N").initial_value("3")
+                 .bind(&level))
+        .move();
+
+    REQUIRE(parser.parse(std::vector<std::string_view>{}).result_code()
+            == ParserResultCode::SUCCESS);
+    REQUIRE(level == 3);
+    REQUIRE(parser.parse({"--level", "5"}).result_code()
+            == ParserResultCode::SUCCESS);
+    REQUIRE(level == 5);
+}
+
+TEST_CASE("Invalid bindings")
+{
+    using namespace argos;
+    int a = 0, b = 0;
+    REQUIRE_THROWS(ArgumentParser("test")
+                       .add(Option{"-a"}.operation(OptionOperation::NONE)
+                                .bind(&a)));
+
+    auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Option{"-a"}.argument("N").bind(&a))
+        .add(Option{"-b"}.argument("N").alias("-a").bind(&b))
+        .move();
+    REQUIRE_THROWS(parser.parse({"-a", "1"}));
+}
+
+TEST_CASE("parse_batch doesn't accept bound variables")
+{
+    using namespace argos;
+    int a = 0;
+    const auto parser = ArgumentParser("test")
+        .auto_exit(false)
+        .add(Option{"-a"}.argument("N").bind(&a))
+        .move();
+    REQUIRE_THROWS(parser.parse_batch({{"-a", "1"}, {"-a", "2"}}));
+}
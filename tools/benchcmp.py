@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+# ===========================================================================
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-18.
+#
+# This file is distributed under the BSD License.
+# License text is included with the source distribution.
+# ===========================================================================
+
+import argparse
+import json
+import sys
+
+
+def make_arg_parser():
+    ap = argparse.ArgumentParser(
+        description="Compares two JSON files written by ArgosBench --json"
+                    " and lists the change in time, allocations and"
+                    " allocated bytes per operation for each benchmark.")
+    ap.add_argument("BEFORE", help="The results of the first run")
+    ap.add_argument("AFTER", help="The results of the second run")
+    ap.add_argument("-t", "--threshold", type=float, default=0,
+                    help="Only list benchmarks where the time changed by"
+                         " more than THRESHOLD percent.")
+    return ap
+
+
+def read_results(file_name):
+    with open(file_name, encoding="utf-8") as f:
+        return {b["name"]: b for b in json.load(f)["benchmarks"]}
+
+
+def percent(before, after):
+    if before == 0:
+        return 0.0 if after == 0 else float("inf")
+    return 100.0 * (after - before) / before
+
+
+def main():
+    args = make_arg_parser().parse_args()
+    before = read_results(args.BEFORE)
+    after = read_results(args.AFTER)
+
+    print("%-48s %12s %12s %8s %10s %12s" % ("Benchmark", "Before ns",
+                                              "After ns", "Time",
+                                              "Allocs", "Bytes"))
+    for name, a in after.items():
+        b = before.get(name)
+        if b is None:
+            continue
+        time_diff = percent(b["ns_per_op"], a["ns_per_op"])
+        if abs(time_diff) < args.threshold:
+            continue
+        print("%-48s %12.0f %12.0f %+7.1f%% %+10.1f %+12.0f"
+              % (name, b["ns_per_op"], a["ns_per_op"], time_diff,
+                 a["allocs_per_op"] - b["allocs_per_op"],
+                 a["bytes_per_op"] - b["bytes_per_op"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -9,25 +9,30 @@
 # ===========================================================================
 
 import argparse
+import os
 import re
 import subprocess
 import sys
 
 
 def make_arg_parser():
-    ap = argparse.ArgumentParser()
-    ap.add_argument("FILE", help="Any file supported by the nm command")
+    ap = argparse.ArgumentParser(
+        description="Lists the size of each function in FILE. If more than"
+                    " one file is given, the total sizes of the files are"
+                    " compared instead.")
+    ap.add_argument("FILE", nargs="+",
+                    help="Any file supported by the nm command")
     return ap
 
 
-def main():
-    args = make_arg_parser().parse_args()
-    output = subprocess.run(["nm", "-n", "--demangle", args.FILE],
+def get_function_sizes(file_name):
+    output = subprocess.run(["nm", "-n", "--demangle", file_name],
                             capture_output=True)
     if output.stderr:
         sys.stderr.write(output.stderr.decode("utf-8"))
-        return 1
+        return None
 
+    result = []
     start_addr = 0
     func_name = None
     nm_re = re.compile(r"^([0-9a-f]*)\s+([a-zA-Z?])\s(.+)$")
@@ -42,9 +47,39 @@ def main():
             continue
         addr = int(m.group(1), 16)
         if func_name and addr > start_addr:
-            print("%6d %s" % (addr - start_addr, func_name))
+            result.append((addr - start_addr, func_name))
         func_name = m.group(3) if m.group(2) in "tT" else None
         start_addr = addr
+    return result
+
+
+def compare_files(file_names):
+    rows = []
+    for file_name in file_names:
+        sizes = get_function_sizes(file_name)
+        if sizes is None:
+            return 1
+        rows.append((file_name, os.path.getsize(file_name),
+                     sum(size for size, _ in sizes)))
+
+    print("%10s %10s %10s  %s" % ("Size", "Code", "Code diff", "File"))
+    base_code = rows[0][2]
+    for file_name, file_size, code_size in rows:
+        print("%10d %10d %+10d  %s" % (file_size, code_size,
+                                       code_size - base_code, file_name))
+    return 0
+
+
+def main():
+    args = make_arg_parser().parse_args()
+    if len(args.FILE) > 1:
+        return compare_files(args.FILE)
+
+    sizes = get_function_sizes(args.FILE[0])
+    if sizes is None:
+        return 1
+    for size, func_name in sizes:
+        print("%6d %s" % (size, func_name))
     return 0
 
 
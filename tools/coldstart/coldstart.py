@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+# -*- coding: UTF-8 -*-
+# ===========================================================================
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-18.
+#
+# This file is distributed under the BSD License.
+# License text is included with the source distribution.
+# ===========================================================================
+
+import argparse
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# The programs and their fixed command lines. The startup_stage programs
+# are built from startup_stage.cpp, each stage adds to the one before,
+# and hello is the final stage.
+PROGRAMS = [
+    ("startup_stage0", []),
+    ("startup_stage1", []),
+    ("startup_stage2", []),
+    ("startup_stage3", []),
+    ("hello", ["-n", "3", "World"]),
+    ("rot13", ["-n", "5", "Hello", "world"]),
+    ("table", ["alpha", "beta", "-r", "gamma", "delta"]),
+    ("whereis", ["-p", "/usr/bin:/bin", "-e", ".sh", "sh"]),
+]
+
+STAGES = [
+    ("C++ program", None, "startup_stage0"),
+    ("C++ runtime and std::cout", "startup_stage0", "startup_stage1"),
+    ("std::function and shared_ptr", "startup_stage1", "startup_stage2"),
+    ("ArgumentParser definition", "startup_stage2", "startup_stage3"),
+    ("Parsing and output", "startup_stage3", "hello"),
+]
+
+
+def make_arg_parser():
+    ap = argparse.ArgumentParser(
+        description="Builds the hello, rot13, table and whereis examples"
+                    " along with a set of baseline programs, and runs each"
+                    " of them many times with a fixed command line to"
+                    " measure the cost of starting and stopping a process"
+                    " that uses Argos.")
+    ap.add_argument("-b", "--build-dir",
+                    default=os.path.join(os.getcwd(), "coldstart_build"),
+                    help="The build directory. The default is"
+                         " ./coldstart_build.")
+    ap.add_argument("--no-build", action="store_true",
+                    help="Use the programs that are already in the build"
+                         " directory.")
+    ap.add_argument("-n", "--runs", type=int, default=2000,
+                    help="The number of times each program is run. The"
+                         " default is 2000.")
+    ap.add_argument("--json", metavar="FILE",
+                    help="Also write the results to FILE in JSON format.")
+    ap.add_argument("FILTER", nargs="*",
+                    help="Only run the programs with these names.")
+    return ap
+
+
+def build(build_dir):
+    subprocess.run(["cmake", "-S", SCRIPT_DIR, "-B", build_dir,
+                    "-DCMAKE_BUILD_TYPE=Release"],
+                   check=True, stdout=subprocess.DEVNULL)
+    subprocess.run(["cmake", "--build", build_dir, "-j",
+                    str(os.cpu_count() or 1)],
+                   check=True, stdout=subprocess.DEVNULL)
+
+
+def count_instructions(path, args, runs):
+    """Returns the average number of user space instructions per run,
+    or None if perf isn't available."""
+    if not shutil.which("perf"):
+        return None
+    result = subprocess.run(["perf", "stat", "-x", ",", "-e",
+                             "instructions:u", "-r", str(runs), "--",
+                             path] + args,
+                            stdout=subprocess.DEVNULL,
+                            stderr=subprocess.PIPE, text=True)
+    for line in result.stderr.splitlines():
+        fields = line.split(",")
+        if len(fields) > 2 and fields[2].startswith("instructions"):
+            try:
+                return float(fields[0])
+            except ValueError:
+                return None
+    return None
+
+
+def measure(runner, path, args, runs):
+    # Let the first runs load the program and its libraries into the
+    # page cache.
+    subprocess.run([runner, "10", path] + args, check=True,
+                   stdout=subprocess.DEVNULL)
+    output = subprocess.run([runner, str(runs), path] + args, check=True,
+                            stdout=subprocess.PIPE, text=True).stdout
+    rows = [[int(v) for v in line.split()] for line in output.splitlines()]
+    times = [row[0] / 1000.0 for row in rows]
+    return {
+        "runs": runs,
+        "wall_us_median": statistics.median(times),
+        "wall_us_mean": statistics.fmean(times),
+        "wall_us_min": min(times),
+        "instructions": count_instructions(path, args, min(runs, 200)),
+        "minor_faults": statistics.fmean(row[1] for row in rows),
+        "major_faults": statistics.fmean(row[2] for row in rows),
+        # ru_maxrss is in kilobytes on Linux.
+        "peak_rss_kb": statistics.median(row[3] for row in rows),
+    }
+
+
+def print_results(results):
+    print("%-16s %10s %10s %10s %12s %8s %8s %10s"
+          % ("Program", "Median us", "Mean us", "Min us", "Instructions",
+             "MinFlt", "MajFlt", "RSS kB"))
+    for name, r in results.items():
+        instructions = ("%12.0f" % r["instructions"]
+                        if r["instructions"] is not None else "%12s" % "n/a")
+        print("%-16s %10.1f %10.1f %10.1f %s %8.1f %8.1f %10.0f"
+              % (name, r["wall_us_median"], r["wall_us_mean"],
+                 r["wall_us_min"], instructions, r["minor_faults"],
+                 r["major_faults"], r["peak_rss_kb"]))
+
+
+def print_stages(results):
+    if not all(s in results for _, _, s in STAGES):
+        return
+    print()
+    print("%-32s %10s %12s %8s %10s"
+          % ("Start-up cost of", "Median us", "Instructions", "MinFlt",
+             "RSS kB"))
+    for title, before, after in STAGES:
+        a = results[after]
+        b = results[before] if before else None
+
+        def diff(key):
+            if a[key] is None or (b and b[key] is None):
+                return None
+            return a[key] - b[key] if b else a[key]
+
+        instructions = diff("instructions")
+        print("%-32s %+10.1f %s %+8.1f %+10.0f"
+              % (title, diff("wall_us_median"),
+                 "%+12.0f" % instructions if instructions is not None
+                 else "%12s" % "n/a",
+                 diff("minor_faults"), diff("peak_rss_kb")))
+
+
+def main():
+    args = make_arg_parser().parse_args()
+    if not args.no_build:
+        build(args.build_dir)
+
+    runner = os.path.join(args.build_dir, "coldstart_runner")
+    results = {}
+    for name, program_args in PROGRAMS:
+        if args.FILTER and name not in args.FILTER:
+            continue
+        path = os.path.join(args.build_dir, name)
+        if not os.path.exists(path):
+            sys.stderr.write("%s: no such file\n" % path)
+            return 1
+        results[name] = measure(runner, path, program_args, args.runs)
+
+    print_results(results)
+    print_stages(results)
+    if args.json:
+        with open(args.json, "w", encoding="utf-8") as f:
+            json.dump({"programs": results}, f, indent=2)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
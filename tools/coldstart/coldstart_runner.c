@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * Copyright © 2026 Jan Erik Breimo. All rights reserved.
+ * Created by Jan Erik Breimo on 2026-10-18.
+ *
+ * This file is distributed under the BSD License.
+ * License text is included with the source distribution.
+ ****************************************************************************/
+
+/*
+ * Runs a program RUNS times and prints a line with the wall time in
+ * nanoseconds, the number of minor and major page faults, and the peak
+ * resident set size in kilobytes for each run.
+ *
+ * coldstart.py uses this program rather than starting the programs
+ * itself because the kernel includes the memory of the process that
+ * starts a program in the program's peak RSS, and a Python interpreter
+ * would hide the actual numbers.
+ */
+#include <fcntl.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+extern char** environ;
+
+static long long now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s RUNS PROGRAM [ARGUMENT ...]\n", argv[0]);
+        return 2;
+    }
+
+    long runs = strtol(argv[1], NULL, 10);
+    int dev_null = open("/dev/null", O_WRONLY);
+    if (dev_null == -1)
+    {
+        perror("/dev/null");
+        return 1;
+    }
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, dev_null, 1);
+    posix_spawn_file_actions_adddup2(&actions, dev_null, 2);
+
+    for (long i = 0; i < runs; ++i)
+    {
+        long long start = now_ns();
+        pid_t pid;
+        if (posix_spawn(&pid, argv[2], &actions, NULL, argv + 2, environ))
+        {
+            perror(argv[2]);
+            return 1;
+        }
+        int status;
+        struct rusage usage;
+        if (wait4(pid, &status, 0, &usage) == -1)
+        {
+            perror("wait4");
+            return 1;
+        }
+        long long elapsed = now_ns() - start;
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            fprintf(stderr, "%s failed with status %d\n", argv[2], status);
+            return 1;
+        }
+        printf("%lld %ld %ld %ld\n", elapsed, usage.ru_minflt,
+               usage.ru_majflt, usage.ru_maxrss);
+    }
+
+    posix_spawn_file_actions_destroy(&actions);
+    close(dev_null);
+    return 0;
+}
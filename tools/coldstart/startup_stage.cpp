@@ -0,0 +1,84 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+
+// The baseline programs for coldstart.py. STARTUP_STAGE selects how much
+// of the start-up of the hello example the program performs:
+//
+// 0. Nothing, only the cost of starting a C++ program.
+// 1. Uses std::cout, like TextWriter does by default. This is also the
+//    first stage that loads the C++ runtime library, the linker drops it
+//    from stage 0 on most platforms.
+// 2. Also creates the kind of shared_ptr and std::function objects
+//    that the parser definition is built from.
+// 3. Also defines the hello example's ArgumentParser, but doesn't parse
+//    the arguments.
+//
+// The hello example itself is the fourth and final stage.
+
+#if STARTUP_STAGE >= 1
+    #include <iostream>
+#endif
+
+#if STARTUP_STAGE >= 2
+    #include <functional>
+    #include <memory>
+    #include <string>
+    #include <vector>
+#endif
+
+#if STARTUP_STAGE >= 3
+    #include <Argos/Argos.hpp>
+#endif
+
+namespace
+{
+#if STARTUP_STAGE >= 2
+    struct Definition
+    {
+        std::string name;
+        std::function<bool(int)> callback;
+    };
+
+    struct Definitions
+    {
+        std::vector<std::unique_ptr<Definition>> items;
+    };
+#endif
+}
+
+int main(int argc, char* argv[])
+{
+    (void)argc;
+    (void)argv;
+#if STARTUP_STAGE >= 1
+    std::ostream* stream = &std::cout;
+    stream->flush();
+#endif
+
+#if STARTUP_STAGE >= 2
+    auto definitions = std::make_shared<Definitions>();
+    for (const char* name : {"NAME", "-n", "--number"})
+    {
+        definitions->items.push_back(std::make_unique<Definition>(
+            Definition{name, [argc](int n) {return n < argc;}}));
+    }
+    if (definitions->items.empty() || !definitions->items[0]->callback(0))
+        return 1;
+#endif
+
+#if STARTUP_STAGE >= 3
+    auto parser = argos::ArgumentParser(argv[0])
+        .about("Displays a greeting to someone or something.")
+        .add(argos::Argument("NAME").optional(true)
+            .help("The person or thing to greet."))
+        .add(argos::Option{"-n", "--number"}.argument("NUM")
+            .help("The number of times to repeat the greeting."))
+        .move();
+#endif
+    return 0;
+}